@@ -42,6 +42,14 @@ ApiMetricsReporter::~ApiMetricsReporter()
     }
 }
 
+void ApiMetricsReporter::ReportPercentage(const std::string &name, uint32_t percent)
+{
+    if (name.empty()) {
+        return;
+    }
+    HISTOGRAM_PERCENTAGE(name.c_str(), static_cast<int32_t>(percent));
+}
+
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
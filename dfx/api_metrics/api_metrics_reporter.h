@@ -42,6 +42,8 @@ public:
     ApiMetricsReporter(const ApiMetricsReporter &other) = delete;
     ApiMetricsReporter &operator=(const ApiMetricsReporter &other) = delete;
 
+    static void ReportPercentage(const std::string &name, uint32_t percent);
+
 private:
     std::string name_;
     unsigned int metricsType_;
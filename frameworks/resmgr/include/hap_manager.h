@@ -18,8 +18,12 @@
 #include "res_config_impl.h"
 #include "hap_resource.h"
 #include "hap_resource_manager.h"
+#include "mmap_file.h"
+#include "preload_recorder.h"
 #include "res_desc.h"
+#include "resource_handle.h"
 #include "resource_manager.h"
+#include <atomic>
 #include <shared_mutex>
 #include <set>
 
@@ -61,6 +65,15 @@ public:
      */
     RState UpdateResConfig(ResConfig &resConfig);
 
+    /**
+     * Update the resConfig, nothing is updated if no field of the resConfig is changed, and the resources are
+     * filtered again only if the locale is changed
+     * @param resConfig the input new resource config
+     * @param changes the mask of CONFIG_CHANGE_* flags of the changed fields
+     * @return SUCCESS if the resConfig updated success, else HAP_INIT_FAILED
+     */
+    RState UpdateResConfig(ResConfig &resConfig, uint32_t &changes);
+
     /**
      * Update the override resConfig
      * @param resConfig the input new override resource config
@@ -184,10 +197,77 @@ public:
      * @param isGetOverrideResource get override resource flag, default value is false
      * @param density the screen density, within the area of OHOS::Global::Resource::ScreenDensity,
      *      default value is SCREEN_DENSITY_NOT_SET
+     * @param isRecord whether the id is recorded by the preload recorder, false for the preload itself
      * @return the best resource path
      */
     const std::shared_ptr<ValueUnderQualifierDir> FindQualifierValueById(uint32_t id,
-        bool isGetOverrideResource = false, uint32_t density = ScreenDensity::SCREEN_DENSITY_NOT_SET);
+        bool isGetOverrideResource = false, uint32_t density = ScreenDensity::SCREEN_DENSITY_NOT_SET,
+        bool isRecord = true);
+
+    /**
+     * Find the best resources of a batch of ids, under one lock and one snapshot of the config
+     * @param ids the resource ids
+     * @param outValues the output resources, same order as ids, nullptr for the id not found
+     * @param resConfig the output snapshot of the config the resources are matched with
+     * @param isGetOverrideResource get override resource flag, default value is false
+     * @return true if the config snapshot is taken, else false
+     */
+    bool FindResourcesByIds(const std::vector<uint32_t> &ids, std::vector<std::shared_ptr<IdItem>> &outValues,
+        ResConfigImpl &resConfig, bool isGetOverrideResource = false);
+
+    /**
+     * Find the best resource of the handle, the candidates of the handle are resolved again only if
+     * the resource list is changed, and the best one is selected again only if the config is changed
+     * @param handle the resource handle
+     * @return the best resource, nullptr if the resource is removed or not matched
+     */
+    const std::shared_ptr<IdItem> FindResourceByHandle(ResourceHandleImpl &handle);
+
+    /**
+     * Get the generation of the resource list, increased when the haps or overlays are added or removed
+     * @return the resource generation
+     */
+    inline uint32_t GetResourceGeneration() const
+    {
+        return resourceGeneration_.load();
+    }
+
+    /**
+     * Get the generation of the config, increased when the config or the override config is updated
+     * @return the config generation
+     */
+    inline uint32_t GetConfigGeneration() const
+    {
+        return configGeneration_.load();
+    }
+
+    /**
+     * Get the fields changed by the latest update of the config or the override config, a cache built at the
+     * previous config generation only needs to drop the entries that depend on these fields
+     * @return the mask of CONFIG_CHANGE_* flags
+     */
+    inline uint32_t GetLastConfigChanges() const
+    {
+        return lastConfigChanges_.load();
+    }
+
+    /**
+     * Record the resource ids looked up by id until the window expires
+     * @param durationMs the recording window in milliseconds, 0 to stop recording
+     */
+    inline void StartPreloadRecord(uint32_t durationMs)
+    {
+        preloadRecorder_.Start(durationMs);
+    }
+
+    /**
+     * Get the recorded resource ids
+     * @return the ids in the order they were first accessed
+     */
+    inline std::vector<uint32_t> GetPreloadRecord()
+    {
+        return preloadRecorder_.GetIds();
+    }
     
     /**
      * Find best resource path by resource name
@@ -233,6 +313,16 @@ public:
     RState GetMediaData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t& len,
         std::unique_ptr<uint8_t[]> &outValue);
 
+    /**
+     * Get the media data shared with the process-wide media cache
+     * @param qualifierDir the QualifierDir
+     * @param len the output data len
+     * @param outValue the output shared media data, it must not be modified
+     * @return SUCCESS if get the media data success, else NOT_FOUND
+     */
+    RState GetMediaData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t& len,
+        std::shared_ptr<const uint8_t[]> &outValue);
+
     /**
      * Get the mediabase64 data
      * @param qualifierDir the QualifierDir
@@ -242,7 +332,8 @@ public:
     RState GetMediaBase64Data(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, std::string &outValue);
 
     /**
-     * Get the Profile data, only for compress hap
+     * Get the Profile data, the profile of a hap is extracted and the profile of an unpacked resources.index is
+     * copied from the read-only mapping of the file
      * @param qualifierDir the QualifierDir
      * @param len the output profile data len
      * @param outValue the output profile data
@@ -261,6 +352,21 @@ public:
     RState FindRawFileFromHap(const std::string &rawFileName, size_t &len,
         std::unique_ptr<uint8_t[]> &outValue);
 
+    /**
+     * Read the raw file of the compressed hap into the media cache, later FindRawFileFromHap is served from the cache
+     * @param rawFileName the raw file name
+     * @return SUCCESS if the raw file is cached, NOT_ENOUGH_MEM if it is too large for the media cache,
+     *     else NOT_FOUND
+     */
+    RState PrefetchRawFile(const std::string &rawFileName);
+
+    /**
+     * Get the offset of the media file in the compressed hap
+     * @param qualifierDir the QualifierDir
+     * @return the offset of the media file, 0 if the offset is unknown
+     */
+    uint64_t GetMediaDataOffset(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir);
+
     /**
      * Find raw file descriptor from hap
      * @param rawFileName the raw file name
@@ -465,13 +571,57 @@ private:
     const std::shared_ptr<ValueUnderQualifierDir> GetBestMatchResource(
         const std::vector<std::shared_ptr<IdValues>> &candidates,
         uint32_t density, bool isGetOverrideResource);
+
+    const std::shared_ptr<ValueUnderQualifierDir> GetBestMatchResource(
+        const std::vector<std::shared_ptr<IdValues>> &candidates,
+        uint32_t density, const std::shared_ptr<ResConfigImpl> &currentResConfig);
 #if defined(__ARKUI_CROSS__)
     void RemoveHapResource(const std::string &path);
 #endif
+    /**
+     * Get the read-only mapped file data of the uncompressed resource, the mapping is cached per file
+     * @param qualifierDir the QualifierDir
+     * @param resType the expected resource type
+     * @param len the output file data len
+     * @param outValue the output file data, which keeps the mapping alive
+     * @return SUCCESS if the file is mapped success, else NOT_FOUND
+     */
+    RState GetMappedFileData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, const ResType resType,
+        size_t &len, std::shared_ptr<const uint8_t[]> &outValue);
+
+    /**
+     * Release the cached file mappings of the resource, the data already handed out stays valid
+     * @param indexPath the resource index path
+     */
+    void ReleaseMappedFiles(const std::string &indexPath);
+
     static bool Init();
 
     std::shared_ptr<ResConfigImpl> getCompleteOverrideConfig(bool isGetOverrideResource);
 
+    /**
+     * Snapshot the config used to load a hap outside the lock, the caller holds the read lock
+     * @param configGeneration the config generation of the snapshot
+     * @return the config snapshot, nullptr if failed
+     */
+    std::shared_ptr<ResConfigImpl> GetLoadConfigSnapshot(uint32_t &configGeneration);
+
+    /**
+     * Append a hap resource loaded outside the lock, the caller holds the write lock
+     * @param pResource the loaded hap resource
+     * @param configGeneration the config generation the resource was loaded with
+     */
+    void PublishHapResource(const std::shared_ptr<HapResource> &pResource, uint32_t configGeneration);
+
+    /**
+     * Let the hap resources read what a locale switch needs before the write lock is taken
+     * @param isOverride whether the override config is going to be updated
+     * @param resConfig the input new resource config
+     */
+    void PrepareLocaleUpdate(bool isOverride, ResConfig &resConfig);
+
+    bool IsOverlayLoaded(const std::string &path, const std::vector<std::string> &overlayPaths);
+
     static bool icuInitialized;
 
     std::shared_ptr<ResConfigImpl> resConfig_;
@@ -489,6 +639,11 @@ private:
 #endif
     std::shared_mutex mutex_;
 
+    // key is index path, value is the mapped files of the resource, keyed by file path
+    std::unordered_map<std::string, std::unordered_map<std::string, std::shared_ptr<MmapFile>>> mappedFiles_;
+
+    std::mutex mappedFilesLock_;
+
     // indicate manager is system hap manager
     bool isSystem_;
 
@@ -497,6 +652,17 @@ private:
     bool isThemeSystemResEnable_{ false };
 
     bool isUpdateAppConfig_{ true };
+
+    std::atomic<uint32_t> resourceGeneration_{ 0 };
+
+    std::atomic<uint32_t> configGeneration_{ 0 };
+
+    std::atomic<uint32_t> lastConfigChanges_{ 0 };
+
+    PreloadRecorder preloadRecorder_;
+
+    // the raw files are looked up in the media cache only after one of them is prefetched
+    std::atomic<bool> hasPrefetchedRawFile_{ false };
 };
 } // namespace Resource
 } // namespace Global
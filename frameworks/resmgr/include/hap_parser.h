@@ -158,13 +158,23 @@ public:
     static RState IsRawDirUnCompressed(const std::string &pathName, bool &outValue);
 
     /**
-     * Create resource config from KeyParams
+     * Create resource config from KeyParams, equal KeyParams share the same immutable config
      * @param keyParams the keyParams contain type and value
      * @return the resource config related to the keyParams
      */
     static std::shared_ptr<ResConfigImpl> CreateResConfigFromKeyParams(
         const std::vector<std::shared_ptr<KeyParam>> &keyParams);
 
+    /**
+     * Build a new resource config from KeyParams, which is not shared
+     * @param keyParams the keyParams contain type and value
+     * @return the resource config related to the keyParams
+     */
+    static std::shared_ptr<ResConfigImpl> BuildResConfigFromKeyParams(
+        const std::vector<std::shared_ptr<KeyParam>> &keyParams);
+
+    static std::string BuildResConfigPoolKey(const std::vector<std::shared_ptr<KeyParam>> &keyParams);
+
     struct ResConfigKey {
         const char *language = nullptr;
         const char *script = nullptr;
@@ -38,6 +38,29 @@ public:
 
     void SetResDesc(std::shared_ptr<ResDesc> &resDesc);
 
+    /**
+     * Check whether some of the keys skipped by the locale filter match the current config
+     * @param pendingKeys the skipped keys
+     * @return true if the index is needed to parse the matched keys, else false
+     */
+    bool HasMatchedPendingKeys(const std::vector<std::shared_ptr<ResKey>> &pendingKeys);
+
+    /**
+     * Set the index data read by the caller, so ParsePendingKeys does not read it again
+     * @param buffer the index data, moved to the parser
+     * @param bufLen the length of the index data
+     */
+    void SetIndexData(std::unique_ptr<uint8_t[]> &buffer, size_t bufLen);
+
+    /**
+     * Parse the keys skipped by the locale filter of an earlier parse, the index is read again only if some of
+     * them match the current config and it is not set by SetIndexData
+     * @param path the index file or hap path
+     * @param pendingKeys the skipped keys, the keys matching the current config are moved to the ResDesc
+     * @return true if parse success, else false
+     */
+    bool ParsePendingKeys(const char *path, std::vector<std::shared_ptr<ResKey>> &pendingKeys);
+
     inline const std::shared_ptr<ResDesc> GetResDesc()
     {
         return resDesc_;
@@ -54,6 +77,8 @@ private:
 
     bool SkipParseItem(const std::shared_ptr<ResKey> &key, bool &match);
 
+    bool IsLocaleDeferred(const std::shared_ptr<ResKey> &key, bool match);
+
     int32_t ParseId(uint32_t &offset, std::shared_ptr<ResId> id);
 
     int32_t ParseIdItem(uint32_t &offset, std::shared_ptr<IdItem> idItem);
@@ -71,6 +96,8 @@ private:
     std::vector<std::string> deviceTypes_;
     bool loadAll_{false};
     bool isUpdate_{false};
+    // the keys skipped only because their locale does not match, parsed later by ParsePendingKeys
+    std::vector<std::shared_ptr<ResKey>> pendingKeys_;
 };
 } // namespace Resource
 } // namespace Global
@@ -20,6 +20,7 @@
 
 #include "hap_resource_v2.h"
 #include "res_config_impl.h"
+#include "resource_table_cache.h"
 
 namespace OHOS {
 namespace Global {
@@ -43,6 +44,34 @@ public:
     static int32_t ParseStringArray(uint32_t &offset, std::vector<std::string> &values, size_t bufLen, uint8_t *buf);
 
     static int32_t ParseString(uint32_t &offset, std::string &id, size_t bufLen, uint8_t *buf);
+
+    enum TableCacheMode {
+        // map the cache only, it is built by another process
+        OPEN_ONLY,
+        // build the cache on the worker pool if missing or out of date
+        BUILD_ASYNC,
+        // build the cache before the parse returns if missing or out of date
+        BUILD_SYNC,
+    };
+
+    /**
+     * Map the keys and ids from the table cache instead of parsing them
+     * @param tableCachePath the cache path, empty to parse the resource index only
+     * @param mode how the cache is built if missing or out of date
+     */
+    inline void SetTableCachePath(const std::string &tableCachePath, TableCacheMode mode)
+    {
+        tableCachePath_ = tableCachePath;
+        tableCacheMode_ = mode;
+    }
+
+    /**
+     * Build the table cache of the resource, used by the privileged process building the system resource cache
+     * @param path the resource path
+     * @param cachePath the cache path
+     * @return true if the cache is up to date or written, else false
+     */
+    static bool PrepareTableCache(const std::string &path, const std::string &cachePath);
 private:
     bool GetIndexMmap(const char *path);
 
@@ -58,6 +87,14 @@ private:
 
     int32_t ParseKeyParam(uint32_t &offset, std::shared_ptr<KeyParam> keyParam, bool &match);
 
+    void MatchKeyParam(std::shared_ptr<KeyParam> keyParam, bool &match);
+
+    int32_t AddKey(std::shared_ptr<KeyInfo> key, bool match);
+
+    int32_t LoadKeysFromCache();
+
+    bool BuildTableCache();
+
     void GetLimitKeyValue(KeyType type);
 
     int32_t ParseIds(uint32_t &offset);
@@ -86,6 +123,17 @@ private:
 
     std::string deviceType_;
     std::vector<std::string> deviceTypes_;
+
+    std::string path_;
+
+    std::string tableCachePath_;
+
+    TableCacheMode tableCacheMode_{OPEN_ONLY};
+
+    std::shared_ptr<ResourceTableCache> tableCache_{nullptr};
+
+    // all keys of the resource index, written to the table cache
+    std::vector<ResourceTableCache::Key> rawKeys_;
 };
 } // namespace Resource
 } // namespace Global
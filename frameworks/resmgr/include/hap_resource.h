@@ -123,8 +123,22 @@ public:
      */
     virtual const std::shared_ptr<IdValues> GetIdValuesByName(const std::string name, const ResType resType);
 
+    /**
+     * Get the resource id by resource name, the resource values are not parsed
+     * @param name the resource name
+     * @param resType the resource type
+     * @return the resource id related to resource name, 0 if not found
+     */
+    virtual uint32_t GetResIdByName(const std::string &name, const ResType resType);
+
     virtual RState Update(std::shared_ptr<ResConfigImpl> &defaultConfig);
 
+    /**
+     * Do the file reads of a following Update before the caller takes its lock
+     * @param defaultConfig the config the resource is going to be updated with
+     */
+    virtual void PrepareUpdate(std::shared_ptr<ResConfigImpl> &defaultConfig) {};
+
     /**
      * Get the resource limit keys value which every binary bit corresponds to existing limit key {@link KeyType}
      *
@@ -144,8 +158,11 @@ public:
      */
     virtual void GetLocales(std::set<std::string> &outValue, bool includeSystem) {};
 
-    virtual void UpdateOverlayInfo(std::unordered_map<std::string,
-        std::unordered_map<ResType, uint32_t>> &nameTypeId) {};
+    /**
+     * Remap the ids of the overlay resource to the ids of the same name and type in the target
+     * @param target the target resource of the overlay
+     */
+    virtual void UpdateOverlayInfo(HapResource &target) {};
 
     inline void SetLimitKeysValue(uint32_t limitKeyValue)
     {
@@ -15,6 +15,8 @@
 #ifndef OHOS_RESOURCE_MANAGER_HAPRESOURCEMANAGER_H
 #define OHOS_RESOURCE_MANAGER_HAPRESOURCEMANAGER_H
 
+#include <atomic>
+#include <future>
 #include <shared_mutex>
 #include "hap_resource.h"
 #include "res_config_impl.h"
@@ -92,6 +94,13 @@ public:
 private:
     HapResourceManager() = default;
 
+    // an overlay load run once, either by a worker of the pool or by the thread loading the target
+    struct OverlayLoad {
+        std::atomic<bool> isClaimed{false};
+        std::promise<std::shared_ptr<HapResource>> promise;
+        std::future<std::shared_ptr<HapResource>> future;
+    };
+
     /**
      * get resource from map
      * @param path hap file path
@@ -63,10 +63,12 @@ public:
     virtual bool IsOverlayResource() const;
     virtual const std::shared_ptr<IdValues> GetIdValues(const uint32_t id);
     virtual const std::shared_ptr<IdValues> GetIdValuesByName(const std::string name, const ResType resType);
+    virtual uint32_t GetResIdByName(const std::string &name, const ResType resType);
     virtual RState Update(std::shared_ptr<ResConfigImpl> &defaultConfig);
+    virtual void PrepareUpdate(std::shared_ptr<ResConfigImpl> &defaultConfig);
     virtual std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> BuildNameTypeIdMapping();
     virtual void GetLocales(std::set<std::string> &outValue, bool includeSystem);
-    virtual void UpdateOverlayInfo(std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> &nameTypeId);
+    virtual void UpdateOverlayInfo(HapResource &target);
 
     bool Init(std::shared_ptr<ResConfigImpl> &defaultConfig);
     
@@ -74,6 +76,12 @@ public:
     {
         selectedTypes_ = type;
     }
+
+    /**
+     * Keep the keys skipped by the locale filter with their offsets, so a new locale parses only its own keys
+     * @param pendingKeys the keys skipped by the locale filter
+     */
+    void SetPendingKeys(std::vector<std::shared_ptr<ResKey>> &pendingKeys);
 private:
     friend class HapResourceManager;
     friend class HapParser;
@@ -83,6 +91,8 @@ private:
     
     RState UpdateResConfig(std::shared_ptr<ResConfigImpl> &defaultConfig);
 
+    bool IsLocaleLoaded(const std::shared_ptr<ResConfigImpl> &defaultConfig);
+
     bool InitIdList(std::shared_ptr<ResConfigImpl> &defaultConfig);
 
     bool InitMap(const std::shared_ptr<ResKey> &resKey, const std::pair<std::string, std::string> &resPath,
@@ -93,6 +103,14 @@ private:
 
     std::set<std::shared_ptr<ResConfigImpl>> loadedConfig_;
 
+    // the keys not parsed yet because their locale never matched
+    std::vector<std::shared_ptr<ResKey>> pendingKeys_;
+
+    // the index read by PrepareUpdate for the pending keys of the next locale, released by the update
+    std::unique_ptr<uint8_t[]> preparedIndex_;
+
+    size_t preparedIndexLen_{0};
+
     std::map<uint32_t, std::shared_ptr<IdValuesV1>> idValuesMap_;
 
     // the key is name, each restype holds one map
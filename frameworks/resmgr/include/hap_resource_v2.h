@@ -24,6 +24,8 @@
 namespace OHOS {
 namespace Global {
 namespace Resource {
+class ResourceTableCache;
+
 class ValueUnderQualifierDirV2 : public ValueUnderQualifierDir {
 public:
     static const uint32_t DATA_HEAD_LEN = 2;
@@ -149,6 +151,7 @@ public:
     virtual const std::shared_ptr<IdValues> GetIdValues(const uint32_t id);
 
     virtual const std::shared_ptr<IdValues> GetIdValuesByName(const std::string name, const ResType resType);
+    virtual uint32_t GetResIdByName(const std::string &name, const ResType resType);
 
     virtual std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> BuildNameTypeIdMapping();
 
@@ -160,11 +163,36 @@ public:
         std::shared_ptr<MmapFile> mMapFile);
 
     void InitThemeSystemRes();
+
+    /**
+     * Find the ids and names in the compiled table cache instead of the parsed maps, only the resources looked up
+     * are held by the process
+     * @param table the table cache of the resource index
+     */
+    void SetTable(std::shared_ptr<ResourceTableCache> table);
 protected:
     friend class HapResourceManager;
     friend class HapParser;
 
     virtual int32_t ParseLimitPaths(std::shared_ptr<IdValuesV2> idValue);
+
+    std::shared_ptr<IdValuesV2> GetCachedIdValues(uint32_t id);
+
+    std::shared_ptr<IdValuesV2> PutCachedIdValues(uint32_t id, uint32_t type, uint32_t offset,
+        const std::string &name);
+
+    std::shared_ptr<IdValues> GetParsedIdValues(const std::shared_ptr<IdValuesV2> &idValues);
+
+    const std::shared_ptr<IdValues> GetTableIdValues(const uint32_t id);
+
+    const std::shared_ptr<IdValues> GetTableIdValuesByName(const std::string &name, const ResType resType);
+
+    std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> BuildTableNameTypeIdMapping();
+
+    std::shared_ptr<ResourceTableCache> table_;
+
+    // guards idMap_ when the resources are looked up from table_
+    std::mutex tableMutex_;
     
     std::mutex idValuesMutex_;
 
@@ -198,7 +226,7 @@ public:
     virtual ~OverlayResource();
     virtual bool IsOverlayResource() const;
     virtual void GetLocales(std::set<std::string> &outValue, bool includeSystem);
-    virtual void UpdateOverlayInfo(std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> &nameTypeId);
+    virtual void UpdateOverlayInfo(HapResource &target);
 protected:
     virtual int32_t ParseLimitPaths(std::shared_ptr<IdValuesV2> idValue);
 };
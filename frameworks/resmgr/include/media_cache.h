@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_MEDIACACHE_H
+#define OHOS_RESOURCE_MANAGER_MEDIACACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * Process-wide cache of media file contents, keyed by (hap path, file path).
+ * Cached buffers are immutable and shared, entries are evicted in LRU order once the byte budget is exceeded.
+ */
+class MediaCache {
+public:
+    struct Statistics {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t evictions{0};
+        size_t usedBytes{0};
+        size_t capacity{0};
+        size_t count{0};
+    };
+
+    MediaCache(const MediaCache &other) = delete;
+    MediaCache operator=(const MediaCache &other) = delete;
+
+    static MediaCache& GetInstance();
+
+    /**
+     * Get the cached media data
+     *
+     * @param hapPath the hap or resources.index path the media belongs to
+     * @param filePath the media file path inside the hap
+     * @param len the output media data len
+     * @param outValue the output shared media data
+     * @return true if the media data is cached, else false
+     */
+    bool Get(const std::string &hapPath, const std::string &filePath, size_t &len,
+        std::shared_ptr<const uint8_t[]> &outValue);
+
+    /**
+     * Put the media data into cache, the data is ignored if it is larger than the single entry limit
+     *
+     * @param hapPath the hap or resources.index path the media belongs to
+     * @param filePath the media file path inside the hap
+     * @param len the media data len
+     * @param value the shared media data
+     */
+    void Put(const std::string &hapPath, const std::string &filePath, size_t len,
+        const std::shared_ptr<const uint8_t[]> &value);
+
+    /**
+     * Whether the media data fits into the single entry limit of the cache
+     *
+     * @param len the media data len
+     * @return true if Put would keep the data, else false
+     */
+    bool IsCacheable(size_t len);
+
+    /**
+     * Remove all the cached media data of the hap
+     *
+     * @param hapPath the hap or resources.index path
+     */
+    void Invalidate(const std::string &hapPath);
+
+    /**
+     * Remove all the cached media data
+     */
+    void Clear();
+
+    /**
+     * Set the byte budget of the cache, entries are evicted immediately if the budget is exceeded
+     *
+     * @param capacity the byte budget, 0 means disable the cache
+     */
+    void SetCapacity(size_t capacity);
+
+    /**
+     * Get the hit and miss statistics of the cache
+     *
+     * @return the cache statistics
+     */
+    Statistics GetStatistics();
+
+private:
+    MediaCache();
+
+    struct Entry {
+        std::string key;
+        std::string hapPath;
+        size_t len;
+        std::shared_ptr<const uint8_t[]> value;
+    };
+
+    static std::string BuildKey(const std::string &hapPath, const std::string &filePath);
+
+    void EvictLocked();
+
+    void ReportHitRatio(uint32_t lookups, uint32_t hits);
+
+    std::mutex mutex_;
+
+    // most recently used entry is in the front
+    std::list<Entry> lruList_;
+
+    std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+
+    size_t capacity_;
+
+    size_t usedBytes_{0};
+
+    uint64_t hits_{0};
+
+    uint64_t misses_{0};
+
+    uint64_t evictions_{0};
+
+    // the lookups and hits since the hit ratio was reported last time
+    uint32_t pendingLookups_{0};
+
+    uint32_t pendingHits_{0};
+
+    static constexpr size_t DEFAULT_CAPACITY = 8 * 1024 * 1024;
+
+    // a single entry can take at most 1/4 of the budget, so one big media never flushes the whole cache
+    static constexpr size_t MAX_ENTRY_RATIO = 4;
+
+    // the hit ratio is reported once every this many lookups
+    static constexpr uint32_t REPORT_INTERVAL = 1000;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -17,7 +17,9 @@
 #define OHOS_RESOURCE_MANAGER_MMAPFILE_H
 
 #include <cstdint>
+#include <memory>
 #include <stdio.h>
+#include <string>
 
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
 #include "file_mapper.h"
@@ -33,6 +35,13 @@ public:
     
     ~MmapFile();
 
+    /**
+     * Map the whole file read-only, the file is read into memory if mmap is not supported on the platform
+     * @param path the file path
+     * @return the mapped file, nullptr if the file is empty or can not be mapped
+     */
+    static std::shared_ptr<MmapFile> MapReadOnly(const std::string &path);
+
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__)
     FILE* fp_{nullptr};
 #endif
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_PRELOADRECORDER_H
+#define OHOS_RESOURCE_MANAGER_PRELOADRECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * Records the resource ids looked up during a window after start, in the order they are first accessed.
+ * The recorded ids are the hot list passed to Preload on the next start.
+ */
+class PreloadRecorder {
+public:
+    /**
+     * Start recording, the ids recorded before are cleared
+     *
+     * @param durationMs the recording window in milliseconds
+     */
+    void Start(uint32_t durationMs);
+
+    /**
+     * Record the looked up id, it costs an atomic load only when not recording
+     *
+     * @param id the resource id
+     */
+    inline void Record(uint32_t id)
+    {
+        if (!isRecording_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        RecordSlow(id);
+    }
+
+    /**
+     * Get the recorded ids
+     *
+     * @return the ids in the order they were first accessed
+     */
+    std::vector<uint32_t> GetIds();
+
+private:
+    void RecordSlow(uint32_t id);
+
+    std::mutex mutex_;
+
+    std::atomic<bool> isRecording_{false};
+
+    std::chrono::steady_clock::time_point deadline_;
+
+    std::unordered_set<uint32_t> recorded_;
+
+    std::vector<uint32_t> ids_;
+
+    static constexpr size_t MAX_RECORD_COUNT = 4096;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
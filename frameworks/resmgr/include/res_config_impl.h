@@ -15,6 +15,7 @@
 #ifndef OHOS_RESOURCE_MANAGER_RESCONFIGIMPL_H
 #define OHOS_RESOURCE_MANAGER_RESCONFIGIMPL_H
 
+#include <memory>
 #include <stdint.h>
 #include "res_locale.h"
 #include "res_common.h"
@@ -169,6 +170,14 @@ public:
      */
     bool Match(const std::shared_ptr<ResConfigImpl> other, bool isCheckDarkAdaptation = true) const;
 
+    /**
+     * Whether this resConfig match other resConfig regardless of the locale
+     * @param other the other resConfig
+     * @param isCheckDarkAdaptation whether check the color mode match the dark mode
+     * @return true if the qualifiers other than the locale match, else false
+     */
+    bool MatchExceptLocale(const std::shared_ptr<ResConfigImpl> other, bool isCheckDarkAdaptation = true) const;
+
     /**
      * Copy other resConfig to this resConfig
      * @param other the other resConfig
@@ -177,6 +186,13 @@ public:
      */
     bool Copy(ResConfig &other, bool isRead = false);
 
+    /**
+     * Get the fields that differ between this resConfig and other resConfig
+     * @param other the other resConfig
+     * @return the mask of CONFIG_CHANGE_* flags, CONFIG_CHANGE_NONE if Copy(other) changes nothing
+     */
+    uint32_t Diff(const ResConfig &other) const;
+
     /**
      * Complete the local script
      */
@@ -254,8 +270,13 @@ private:
 #ifdef SUPPORT_GRAPHICS
     bool CopyPreferredLocale(const ResConfig &other);
 
-    bool CopyLocale(Locale **currentLocaleInfo, ResLocale **currentResLocale,
+    bool CopyLocale(std::shared_ptr<const Locale> &currentLocaleInfo, ResLocale **currentResLocale,
         const Locale *otherLocaleInfo);
+
+    bool CopyLocale(std::shared_ptr<const Locale> &currentLocaleInfo, ResLocale **currentResLocale,
+        const ResLocale *otherResLocale, const std::shared_ptr<const Locale> &otherLocaleInfo);
+
+    static const Locale *GetOrBuildLocaleInfo(const ResLocale *resLocale, std::shared_ptr<const Locale> &localeInfo);
 #endif
 
     bool IsMccMncMatch(uint32_t mcc,  uint32_t mnc) const;
@@ -279,7 +300,7 @@ private:
 #ifdef SUPPORT_GRAPHICS
     RState BuildResLocale(const char *language, const char *script, const char *region, ResLocale **resLocale);
 
-    RState BuildLocaleInfo(const ResLocale *resLocale, Locale **localeInfo);
+    static std::shared_ptr<const Locale> BuildLocaleInfo(const ResLocale *resLocale);
 #endif
 private:
     ResLocale *resLocale_;
@@ -293,8 +314,9 @@ private:
     InputDevice inputDevice_;
 #ifdef SUPPORT_GRAPHICS
     ResLocale *resPreferredLocale_;
-    Locale *preferredLocaleInfo_;
-    Locale *localeInfo_;
+    // the ICU locales are built from the ResLocales on first access, and shared with the copies
+    mutable std::shared_ptr<const Locale> preferredLocaleInfo_;
+    mutable std::shared_ptr<const Locale> localeInfo_;
 #endif
     uint32_t themeId_;
     bool isCompletedScript_;
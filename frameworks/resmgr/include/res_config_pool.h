@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_RESCONFIGPOOL_H
+#define OHOS_RESOURCE_MANAGER_RESCONFIGPOOL_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "res_config_impl.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * Process-wide pool of the qualifier configs of the resource keys. The same qualifiers repeat in the app hap, the
+ * system hap, the overlays and the hsp modules, so equal configs are interned to one immutable object, which can be
+ * compared by pointer. A config is released once no loaded hap refers to it.
+ */
+class ResConfigPool {
+public:
+    ResConfigPool(const ResConfigPool &other) = delete;
+    ResConfigPool operator=(const ResConfigPool &other) = delete;
+
+    static ResConfigPool& GetInstance();
+
+    /**
+     * Get the pooled config of the qualifiers
+     *
+     * @param key the qualifiers, equal qualifiers must have the same key
+     * @return the pooled config, nullptr if not pooled or released
+     */
+    std::shared_ptr<ResConfigImpl> Get(const std::string &key);
+
+    /**
+     * Put the config of the qualifiers into the pool, the config must not be modified afterwards
+     *
+     * @param key the qualifiers
+     * @param resConfig the config created from the qualifiers
+     * @return the pooled config, which is the config already pooled by another thread if any
+     */
+    std::shared_ptr<ResConfigImpl> Put(const std::string &key, const std::shared_ptr<ResConfigImpl> &resConfig);
+
+    /**
+     * Get the count of the pooled configs which are still referred to
+     *
+     * @return the count of the configs
+     */
+    size_t GetCount();
+
+private:
+    ResConfigPool() = default;
+
+    void PruneLocked();
+
+    std::mutex mutex_;
+
+    std::unordered_map<std::string, std::weak_ptr<ResConfigImpl>> configs_;
+
+    // the released configs are pruned when the pool grows to this size
+    size_t pruneThreshold_{DEFAULT_PRUNE_THRESHOLD};
+
+    static constexpr size_t DEFAULT_PRUNE_THRESHOLD = 256;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -47,6 +47,30 @@ public:
 
     const char *GetScript() const;
 
+    /**
+     * Get the encoded locale, which is computed once the locale is built
+     * @return the language, script and region encoded as Utils::EncodeLocale does
+     */
+    inline uint64_t GetEncodedLocale() const
+    {
+        return encodedLocale_;
+    }
+
+    inline uint16_t GetEncodedLanguage() const
+    {
+        return static_cast<uint16_t>(encodedLocale_ >> LANGUAGE_SHIFT);
+    }
+
+    inline uint32_t GetEncodedScript() const
+    {
+        return static_cast<uint32_t>(encodedLocale_ >> SCRIPT_SHIFT);
+    }
+
+    inline uint16_t GetEncodedRegion() const
+    {
+        return static_cast<uint16_t>(encodedLocale_);
+    }
+
     ResLocale();
 
 #ifdef SUPPORT_GRAPHICS
@@ -100,7 +124,24 @@ public:
 
     static constexpr size_t MIN_BCP47_STR_LEN = 2;
 
+    static constexpr uint64_t SCRIPT_MASK = 0x0000FFFFFFFF0000LU;
+
+    static constexpr uint64_t REGION_MASK = 0x000000000000FFFFLU;
+
 private:
+    void UpdateEncodedLocale();
+
+    static constexpr uint32_t LANGUAGE_SHIFT = 48;
+
+    static constexpr uint32_t SCRIPT_SHIFT = 16;
+
+    // the capacities of the subtags are the same as ICU, including the trailing '\0'
+    static constexpr size_t LANGUAGE_CAPACITY = 12;
+
+    static constexpr size_t SCRIPT_CAPACITY = 6;
+
+    static constexpr size_t REGION_CAPACITY = 4;
+
     RState SetLanguage(const char *language, size_t len);
 
     RState SetScript(const char *script, size_t len);
@@ -114,11 +155,14 @@ private:
     RState Init(const char *language, size_t languageLen, const char *script, size_t scriptLen,
         const char *region, size_t regionLen);
 
-    const char *language_;
+    // the subtags are stored inline, an empty subtag means it is not set
+    char language_[LANGUAGE_CAPACITY] = {0};
+
+    char region_[REGION_CAPACITY] = {0};
 
-    const char *region_;
+    char script_[SCRIPT_CAPACITY] = {0};
 
-    const char *script_;
+    uint64_t encodedLocale_{0};
 
 #ifdef SUPPORT_GRAPHICS
     static Locale *defaultLocale_;
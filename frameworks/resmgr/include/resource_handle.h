@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_RESOURCEHANDLE_H
+#define OHOS_RESOURCE_MANAGER_RESOURCEHANDLE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "hap_resource.h"
+#include "resource_manager.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+class HapManager;
+
+/**
+ * The pre-resolved resource of an id or a name. The candidates of all the loaded haps and overlays are
+ * kept, so the lookup skips the maps of the haps until the resource list changes, and the best match
+ * is only selected again when the config changes.
+ */
+class ResourceHandleImpl : public ResourceManager::ResourceHandle {
+public:
+    ResourceHandleImpl(const std::shared_ptr<HapManager> &hapManager, uint32_t id, const std::string &name,
+        ResType resType, bool isOverride)
+        : hapManager(hapManager), id(id), name(name), resType(resType), isOverride(isOverride)
+    {}
+
+    /** the hap manager the handle belongs to */
+    std::weak_ptr<HapManager> hapManager;
+
+    /** the resource id, used if the name is empty */
+    uint32_t id;
+
+    /** the resource name */
+    std::string name;
+
+    /** the resource type of the name */
+    ResType resType;
+
+    /** whether the handle is resolved under the override config */
+    bool isOverride;
+
+    /** guards the resolved state below */
+    std::mutex mutex;
+
+    /** whether the candidates and the idItem are resolved */
+    bool isResolved{false};
+
+    /** the resource generation of the hap manager the candidates are resolved at */
+    uint32_t resourceGeneration{0};
+
+    /** the config generation of the hap manager the idItem is selected at */
+    uint32_t configGeneration{0};
+
+    /** the resource values of the id in every hap */
+    std::vector<std::shared_ptr<IdValues>> candidates;
+
+    /** the best matched resource */
+    std::shared_ptr<IdItem> idItem;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -17,7 +17,9 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "hap_manager.h"
 #include "resource_manager.h"
@@ -482,7 +484,7 @@ public:
     virtual RState GetMediaBase64DataByName(const char *name, std::string &outValue, uint32_t density = 0);
 
     /**
-     * Get the PROF resource by resource id
+     * Get the PROF resource by resource id, it is served from both a hap and an unpacked resources.index
      * @param name the resource id
      * @param len the data len write to
      * @param outValue the obtain resource path write to
@@ -491,7 +493,7 @@ public:
     virtual RState GetProfileDataById(uint32_t id, size_t &len, std::unique_ptr<uint8_t[]> &outValue);
 
     /**
-     * Get the PROF resource by resource name
+     * Get the PROF resource by resource name, it is served from both a hap and an unpacked resources.index
      * @param name the resource name
      * @param len the data len write to
      * @param outValue the obtain resource path write to
@@ -852,6 +854,133 @@ public:
      */
     virtual RState GetResName(uint32_t id, std::string &outValue);
 
+    /**
+     * Get the MEDIA data by resource id, the data is shared with the media cache and must not be modified
+     * @param id the resource id
+     * @param len the data len write to
+     * @param outValue the shared media data write to
+     * @param density the screen density, within the area of OHOS::Global::Resource::ScreenDensity
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetSharedMediaDataById(uint32_t id, size_t &len, std::shared_ptr<const uint8_t[]> &outValue,
+        uint32_t density = 0);
+
+    /**
+     * Get the MEDIA data by resource name, the data is shared with the media cache and must not be modified
+     * @param name the resource name
+     * @param len the data len write to
+     * @param outValue the shared media data write to
+     * @param density the screen density, within the area of OHOS::Global::Resource::ScreenDensity
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetSharedMediaDataByName(const char *name, size_t &len,
+        std::shared_ptr<const uint8_t[]> &outValue, uint32_t density = 0);
+
+    /**
+     * Read the media and rawfile resources into the media cache on the prefetch worker pool
+     * @param request the resource ids, names and rawfile paths to prefetch
+     * @return the handle to wait or cancel the prefetch, nullptr if the request is empty
+     */
+    virtual std::shared_ptr<PrefetchHandle> Prefetch(const PrefetchRequest &request);
+
+    /**
+     * Resolve the hot resources in background and read the media into the media cache
+     *
+     * @param ids the hot resource ids
+     * @return the handle to wait or cancel the preload, nullptr if nothing to preload
+     */
+    virtual std::shared_ptr<PrefetchHandle> Preload(const std::vector<uint32_t> &ids);
+
+    /**
+     * Record the resource ids looked up by id until the window expires
+     *
+     * @param durationMs the recording window in milliseconds, 0 to stop recording
+     */
+    virtual void StartPreloadRecord(uint32_t durationMs);
+
+    /**
+     * Get the recorded resource ids
+     *
+     * @return the ids in the order they were first accessed
+     */
+    virtual std::vector<uint32_t> GetPreloadRecord();
+
+    /**
+     * Get a batch of resources by id under one snapshot of the config and the resource list
+     * @param items the ids and types to get, the state and value of each item are written back
+     * @param arena the STRING values are appended to, each is null terminated
+     * @return SUCCESS if all the items are found, else NOT_FOUND
+     */
+    virtual RState GetResourcesByIds(std::vector<BatchItem> &items, std::string &arena);
+
+    /**
+     * Create the handle of the resource id
+     * @param id the resource id
+     * @return the resource handle, nullptr if the resource id is not found
+     */
+    virtual std::shared_ptr<ResourceHandle> GetResourceHandle(uint32_t id);
+
+    /**
+     * Create the handle of the resource name
+     * @param name the resource name
+     * @param type the resource type
+     * @return the resource handle, nullptr if the resource name is not found
+     */
+    virtual std::shared_ptr<ResourceHandle> GetResourceHandleByName(const char *name, ResType type);
+
+    /**
+     * Get string resource by the resource handle
+     * @param handle the resource handle
+     * @param outValue the string resource write to
+     * @return SUCCESS if resource exist, else not found
+     */
+    virtual RState GetStringByHandle(const std::shared_ptr<ResourceHandle> &handle, std::string &outValue);
+
+    /**
+     * Get color resource by the resource handle
+     * @param handle the resource handle
+     * @param outValue the color resource write to
+     * @return SUCCESS if resource exist, else not found
+     */
+    virtual RState GetColorByHandle(const std::shared_ptr<ResourceHandle> &handle, uint32_t &outValue);
+
+    /**
+     * Get the generation of the resources
+     *
+     * @return the sum of the resource generation and the config generation of the hap manager
+     */
+    virtual uint64_t GetResourceGeneration();
+
+    /**
+     * Get the generation of the config
+     *
+     * @return the config generation of the hap manager
+     */
+    virtual uint64_t GetConfigGeneration();
+
+    /**
+     * Get the fields changed by the latest update of the config
+     *
+     * @return the mask of CONFIG_CHANGE_* flags
+     */
+    virtual uint32_t GetLastConfigChanges();
+
+    /**
+     * Get the INTARRAY resource by id as a shared int32 buffer, cached until the resource generation changes
+     * @param id the resource id
+     * @param outValue the shared int array write to
+     * @return SUCCESS if resource exist, else not found
+     */
+    virtual RState GetSharedIntArrayById(uint32_t id, std::shared_ptr<const std::vector<int32_t>> &outValue);
+
+    /**
+     * Get the INTARRAY resource by name as a shared int32 buffer, cached until the resource generation changes
+     * @param name the resource name
+     * @param outValue the shared int array write to
+     * @return SUCCESS if resource exist, else not found
+     */
+    virtual RState GetSharedIntArrayByName(const char *name, std::shared_ptr<const std::vector<int32_t>> &outValue);
+
     /**
      * Get the hap manager
      *
@@ -859,6 +988,15 @@ public:
      */
     std::shared_ptr<HapManager> GetHapManager();
 
+    /**
+     * Create a resource manager sharing the loaded haps and the system resources of this one. The config is
+     * copied, so the created one updates its config without affecting this one.
+     *
+     * @param hapPath the hap path the created one reports as added, as it is already loaded
+     * @return the created resource manager, nullptr if failed
+     */
+    std::shared_ptr<ResourceManagerImpl> CloneSharedResourceManager(const std::string &hapPath);
+
     /**
      * Determine whether it is system resourceManager
      *
@@ -892,6 +1030,8 @@ private:
 
     RState RecalculateFloat(const std::string &unit, float &result);
 
+    RState RecalculateFloat(const std::string &unit, float &result, const ResConfigImpl &resConfig);
+
     RState GetFloat(const std::shared_ptr<IdItem> idItem, float &outValue, std::string &unit);
 
     RState GetInteger(const std::shared_ptr<IdItem> idItem, int &outValue);
@@ -900,6 +1040,9 @@ private:
 
     RState GetIntArray(const std::shared_ptr<IdItem> idItem, std::vector<int> &outValue);
 
+    RState GetSharedIntArray(const std::shared_ptr<IdItem> idItem,
+        std::shared_ptr<const std::vector<int32_t>> &outValue);
+
     RState GetSymbol(const std::shared_ptr<IdItem> idItem, uint32_t &outValue);
 
     void ProcessPsuedoTranslate(std::string &outValue);
@@ -910,8 +1053,17 @@ private:
 
     RState GetThemeColor(const std::shared_ptr<IdItem> idItem, uint32_t &outValue);
 
+    RState GetThemeColor(const std::shared_ptr<IdItem> idItem, const ResConfigImpl &resConfig, uint32_t &outValue);
+
     RState GetThemeFloat(const std::shared_ptr<IdItem> idItem, float &outValue);
 
+    RState GetThemeFloat(const std::shared_ptr<IdItem> idItem, const ResConfigImpl &resConfig, float &outValue);
+
+    RState GetBatchItem(const std::shared_ptr<IdItem> idItem, const ResConfigImpl &resConfig, BatchItem &item,
+        std::string &arena);
+
+    RState FindResourceByHandle(const std::shared_ptr<ResourceHandle> &handle, std::shared_ptr<IdItem> &idItem);
+
     RState GetThemeFloat(const std::shared_ptr<IdItem> idItem, float &outValue, std::string &unit);
 
     RState GetThemeMedia(const std::shared_ptr<IdItem> idItem, size_t &len,
@@ -971,8 +1123,18 @@ private:
 
     bool isSystemResMgr_ = false;
 
+    std::string sharedHapPath_;
+
+    std::mutex intArrayCacheMutex_;
+
+    uint64_t intArrayCacheGeneration_ = 0;
+
+    std::unordered_map<uint32_t, std::shared_ptr<const std::vector<int32_t>>> intArrayCache_;
+
     static constexpr int CONFIG_LEN = 128;
 
+    static constexpr size_t MAX_INT_ARRAY_CACHE_SIZE = 256;
+
     static const char* LANGUAGE_KEY;
 };
 } // namespace Resource
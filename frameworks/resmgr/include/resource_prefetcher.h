@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_RESOURCEPREFETCHER_H
+#define OHOS_RESOURCE_MANAGER_RESOURCEPREFETCHER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hap_manager.h"
+#include "resource_manager.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+struct PrefetchItem {
+    /** the resolved media resource, nullptr for rawfile */
+    std::shared_ptr<ValueUnderQualifierDir> qualifierDir;
+
+    /** the rawfile name, empty for media */
+    std::string rawFileName;
+
+    /** the hap or resources.index path the media belongs to, empty for rawfile */
+    std::string hapPath;
+
+    /** the offset of the resource in the hap, used to order the reads */
+    uint64_t offset{0};
+};
+
+class PrefetchTask : public ResourceManager::PrefetchHandle {
+public:
+    PrefetchTask(size_t batchCount, size_t failedCount);
+
+    RState Wait() override;
+
+    bool WaitFor(uint32_t timeoutMs) override;
+
+    void Cancel() override;
+
+    bool IsFinished() override;
+
+    bool IsCancelled() const;
+
+    /**
+     * Mark one batch finished
+     *
+     * @param failedCount the count of resources failed to read in the batch
+     */
+    void FinishBatch(size_t failedCount);
+
+private:
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    size_t pendingBatches_;
+
+    size_t failedCount_;
+
+    std::atomic<bool> isCancelled_{false};
+};
+
+/**
+ * Bounded pool of worker threads shared by all the prefetch tasks and the overlay loads of the process.
+ * Threads are started on demand and live until the process exits, the pool is never destroyed.
+ */
+class PrefetchWorkerPool {
+public:
+    static PrefetchWorkerPool& GetInstance();
+
+    PrefetchWorkerPool(const PrefetchWorkerPool &other) = delete;
+    PrefetchWorkerPool operator=(const PrefetchWorkerPool &other) = delete;
+
+    void Submit(std::function<void()> work);
+
+    size_t GetMaxWorkers() const;
+
+private:
+    PrefetchWorkerPool();
+
+    void WorkLoop();
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    std::deque<std::function<void()>> works_;
+
+    std::vector<std::thread> workers_;
+
+    size_t maxWorkers_;
+
+    size_t idleWorkers_{0};
+
+    static constexpr size_t MAX_WORKERS = 4;
+};
+
+class ResourcePrefetcher {
+public:
+    /**
+     * Read the resources into the media cache on the worker pool. The items are ordered by hap and offset,
+     * then split into contiguous batches, each batch is read sequentially by one worker.
+     *
+     * @param hapManager the hap manager the items are resolved from
+     * @param items the resolved resources
+     * @param failedCount the count of resources failed to resolve
+     * @return the prefetch handle, nullptr if both the items and the failed count are empty
+     */
+    static std::shared_ptr<ResourceManager::PrefetchHandle> Prefetch(const std::shared_ptr<HapManager> &hapManager,
+        std::vector<PrefetchItem> &items, size_t failedCount);
+
+    /**
+     * Resolve the resources on the worker pool, the ids are split into contiguous batches. Each id is resolved
+     * to the best match for the current config, which parses its qualifiers, and the media are read into the
+     * media cache.
+     *
+     * @param hapManager the hap manager the ids are resolved from
+     * @param ids the resource ids
+     * @param isOverride whether the ids are resolved with the override config
+     * @return the preload handle, nullptr if the ids are empty
+     */
+    static std::shared_ptr<ResourceManager::PrefetchHandle> Preload(const std::shared_ptr<HapManager> &hapManager,
+        const std::vector<uint32_t> &ids, bool isOverride);
+
+private:
+    static size_t ReadBatch(const std::shared_ptr<HapManager> &hapManager, const std::vector<PrefetchItem> &batch,
+        const std::shared_ptr<PrefetchTask> &task);
+
+    static size_t PreloadBatch(const std::shared_ptr<HapManager> &hapManager, const std::vector<uint32_t> &batch,
+        bool isOverride, const std::shared_ptr<PrefetchTask> &task);
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
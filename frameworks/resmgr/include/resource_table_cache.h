@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_RESOURCETABLECACHE_H
+#define OHOS_RESOURCE_MANAGER_RESOURCETABLECACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "hap_resource_v2.h"
+#include "mmap_file.h"
+#include "res_desc.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * ResourceTableCache is the lookup tables of a resource index compiled ahead of time. The cache file holds the
+ * qualifiers of every key flattened, the ids sorted, a name hash index and the offsets of the values in the resource
+ * index, all addressed by offsets, so the file is mapped read-only instead of parsing the index again. The system
+ * resource cache is shared by every process, it is built by the privileged resource_table_builder at boot and only
+ * opened by the apps. It is keyed on the device and inode of the resource file, so every path the file is reached
+ * by maps the same cache. The accessors check every offset they follow, so the checksum covers the header only.
+ */
+class ResourceTableCache {
+public:
+    struct Item {
+        uint32_t id;
+        uint32_t type;
+        // offset from the beginning of the resource index, pointing to the resource data
+        uint32_t offset;
+        std::string name;
+    };
+
+    struct Key {
+        uint32_t resConfigId;
+        // <key type, key value> of each qualifier
+        std::vector<std::pair<uint32_t, uint32_t>> params;
+    };
+
+    /**
+     * Map the cache of the resource, the cache must be built from the current resource file, reached by any path
+     * @param sourcePath the resource path
+     * @param cachePath the cache path
+     * @return the cache, nullptr if the cache does not exist or is out of date or damaged
+     */
+    static std::shared_ptr<ResourceTableCache> Open(const std::string &sourcePath, const std::string &cachePath);
+
+    /**
+     * Check the structure of the mapped cache, the resource file it was built from is not checked
+     * @param mapFile the mapped cache
+     * @return the cache, nullptr if the cache is damaged
+     */
+    static std::shared_ptr<ResourceTableCache> Load(const std::shared_ptr<MmapFile> &mapFile);
+
+    /**
+     * Build the cache of the resource and replace the old one atomically
+     * @param sourcePath the resource path
+     * @param keys all keys of the resource index
+     * @param idMap the parsed resources of the resource index
+     * @param cachePath the cache path
+     * @return true if the cache is written, else false
+     */
+    static bool Build(const std::string &sourcePath, const std::vector<Key> &keys,
+        const std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> &idMap, const std::string &cachePath);
+
+    /**
+     * Build the cache on the worker pool, off the load path. The build is skipped if the cache directory is not
+     * writable, or a build of the same cache is running or has failed in this process
+     * @param sourcePath the resource path
+     * @param keys all keys of the resource index
+     * @param idMap the parsed resources of the resource index
+     * @param cachePath the cache path
+     * @return true if the build is submitted, else false
+     */
+    static bool BuildAsync(const std::string &sourcePath, std::vector<Key> &&keys,
+        const std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> &idMap, const std::string &cachePath);
+
+    /**
+     * Rewrite the checksum of the cache header
+     * @param data the cache data
+     * @return true if the data holds a whole header, else false
+     */
+    static bool UpdateChecksum(std::vector<uint8_t> &data);
+
+    /**
+     * Get the cache path of the resource
+     * @param cacheDir the cache directory
+     * @param sourcePath the resource path
+     * @return the cache path
+     */
+    static std::string GetCachePath(const std::string &cacheDir, const std::string &sourcePath);
+
+    /**
+     * Get the cache path of the resource shared by every path of the same file, e.g. a bind mount or a symlink
+     * @param cacheDir the cache directory
+     * @param sourcePath the resource path
+     * @return the cache path, empty if the resource does not exist
+     */
+    static std::string GetSharedCachePath(const std::string &cacheDir, const std::string &sourcePath);
+
+    /**
+     * Remove the caches in the directory which are not in use, e.g. built from a resource replaced by an update
+     * @param cacheDir the cache directory
+     * @param usedCachePaths the caches to keep
+     */
+    static void RemoveUnusedCaches(const std::string &cacheDir, const std::unordered_set<std::string> &usedCachePaths);
+
+    /**
+     * Find the resource by id with a binary search over the sorted ids
+     * @param id the resource id
+     * @param item the found resource
+     * @return true if found, else false
+     */
+    bool FindById(uint32_t id, Item &item) const;
+
+    /**
+     * Find the resource by name with the name hash index
+     * @param name the resource name
+     * @param type the resource type
+     * @param item the found resource
+     * @return true if found, else false
+     */
+    bool FindByName(const std::string &name, uint32_t type, Item &item) const;
+
+    /**
+     * Get the resource by its position in the sorted ids
+     * @param index the position
+     * @param item the resource
+     * @return true if the index is valid, else false
+     */
+    bool GetItem(uint32_t index, Item &item) const;
+
+    /**
+     * Get the flattened keys
+     * @param keys the keys write to
+     * @return true if the keys are valid, else false
+     */
+    bool GetKeys(std::vector<Key> &keys) const;
+
+    inline uint32_t GetItemCount() const
+    {
+        return itemCount_;
+    }
+
+    static const std::string SYSTEM_CACHE_DIR;
+
+    static const std::string APP_CACHE_DIR;
+
+    static const uint32_t CACHE_VERSION = 4;
+
+private:
+    struct CacheItem {
+        uint32_t id;
+        uint32_t type;
+        uint32_t offset;
+        uint32_t nameOffset;
+        uint32_t nameLen;
+        // the next item in the same hash bucket
+        uint32_t next;
+    };
+
+    struct CacheHeader {
+        char tag[4];
+        uint32_t version;
+        uint64_t sourceSize;
+        int64_t sourceMTime;
+        uint32_t sourcePathLen;
+        uint32_t keyCount;
+        uint32_t keysOffset;
+        uint32_t keysLen;
+        uint32_t itemCount;
+        uint32_t bucketCount;
+        uint32_t itemsOffset;
+        uint32_t bucketsOffset;
+        uint32_t namesOffset;
+        uint32_t namesLen;
+        // checksum of the header with this field set to 0
+        uint32_t checksum;
+        uint32_t reserved;
+        uint64_t sourceDev;
+        uint64_t sourceIno;
+    };
+
+    static uint32_t Hash(const uint8_t *data, size_t len, uint32_t seed);
+
+    static uint32_t GetChecksum(const CacheHeader &header);
+
+    static std::string GetCacheName(const std::string &cacheDir, const std::string &key);
+
+    bool Init(const std::shared_ptr<MmapFile> &mapFile);
+
+    bool ToItem(const CacheItem &cacheItem, Item &item) const;
+
+    std::shared_ptr<MmapFile> mapFile_;
+
+    const CacheItem *items_{nullptr};
+
+    const uint32_t *buckets_{nullptr};
+
+    const char *names_{nullptr};
+
+    const uint32_t *keys_{nullptr};
+
+    uint32_t keyCount_{0};
+
+    // count of uint32_t in the keys block
+    uint32_t keysLen_{0};
+
+    uint32_t itemCount_{0};
+
+    uint32_t bucketCount_{0};
+
+    uint32_t namesLen_{0};
+
+    uint64_t sourceSize_{0};
+
+    int64_t sourceMTime_{0};
+
+    uint64_t sourceDev_{0};
+
+    uint64_t sourceIno_{0};
+
+    std::string sourcePath_;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
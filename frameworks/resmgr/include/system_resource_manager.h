@@ -70,6 +70,14 @@ public:
      */
     static void UpdateSysResConfig(ResConfigImpl &resConfig, bool isThemeSystemResEnable);
 
+    /**
+     * Build the table caches of the no sandbox and the sandbox system resource and remove the unused ones, called
+     * by the privileged resource_table_builder at boot, the apps only open the caches.
+     *
+     * @return true if every cache is up to date or written, else false
+     */
+    static bool BuildSystemResourceTableCache();
+
 #if defined(__ARKUI_CROSS__) || defined(__IDE_PREVIEW__)
     /**
      * add system resource for preview
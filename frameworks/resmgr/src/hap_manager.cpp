@@ -33,6 +33,8 @@
 #include "hilog_wrapper.h"
 
 #include "hap_parser.h"
+#include "media_cache.h"
+#include "securec.h"
 #include "utils/utils.h"
 #include "res_common.h"
 
@@ -60,6 +62,9 @@ constexpr uint32_t PLURAL_CACHE_MAX_COUNT = 3;
 const std::string RAW_FILE_PATH = "resources/rawfile/";
 #endif
 
+// prefix of the rawfile key in media cache, keeps rawfiles apart from the media of the same hap
+const std::string RAWFILE_CACHE_PREFIX = "rawfile:";
+
 using ReadLock = std::shared_lock<std::shared_mutex>;
 using WriteLock = std::unique_lock<std::shared_mutex>;
 
@@ -76,6 +81,11 @@ HapManager::HapManager(std::shared_ptr<ResConfigImpl> resConfig, std::vector<std
     : resConfig_(resConfig), hapResources_(hapResources), loadedHapPaths_(loadedHapPaths), isSystem_(isSystem)
 {
     overrideResConfig_->SetColorMode(COLOR_MODE_NOT_SET);
+    for (const auto &resource : hapResources_) {
+        if (!resource->IsSystemResource() && !resource->IsOverlayResource() && resource->IsThemeSystemResEnable()) {
+            isThemeSystemResEnable_ = true;
+        }
+    }
 }
 
 bool HapManager::icuInitialized = HapManager::Init();
@@ -200,8 +210,11 @@ const std::shared_ptr<ValueUnderQualifierDir> HapManager::FindQualifierValueByNa
 }
 
 const std::shared_ptr<ValueUnderQualifierDir> HapManager::FindQualifierValueById(uint32_t id,
-    bool isGetOverrideResource, uint32_t density)
+    bool isGetOverrideResource, uint32_t density, bool isRecord)
 {
+    if (isRecord) {
+        preloadRecorder_.Record(id);
+    }
     ReadLock lock(this->mutex_);
     std::vector<std::shared_ptr<IdValues>> candidates = this->GetResourceList(id);
     if (candidates.size() == 0) {
@@ -210,6 +223,61 @@ const std::shared_ptr<ValueUnderQualifierDir> HapManager::FindQualifierValueById
     return this->GetBestMatchResource(candidates, density, isGetOverrideResource);
 }
 
+bool HapManager::FindResourcesByIds(const std::vector<uint32_t> &ids,
+    std::vector<std::shared_ptr<IdItem>> &outValues, ResConfigImpl &resConfig, bool isGetOverrideResource)
+{
+    outValues.assign(ids.size(), nullptr);
+    ReadLock lock(this->mutex_);
+    const std::shared_ptr<ResConfigImpl> currentResConfig = getCompleteOverrideConfig(isGetOverrideResource);
+    // the values are resolved by the caller with the same config the resources are matched with
+    if (!currentResConfig || !resConfig.Copy(*currentResConfig, true)) {
+        return false;
+    }
+    for (size_t i = 0; i < ids.size(); ++i) {
+        preloadRecorder_.Record(ids[i]);
+        std::vector<std::shared_ptr<IdValues>> candidates = this->GetResourceList(ids[i]);
+        if (candidates.empty()) {
+            continue;
+        }
+        auto qualifierValue = this->GetBestMatchResource(candidates, ScreenDensity::SCREEN_DENSITY_NOT_SET,
+            currentResConfig);
+        if (qualifierValue != nullptr) {
+            outValues[i] = qualifierValue->GetIdItem();
+        }
+    }
+    return true;
+}
+
+const std::shared_ptr<IdItem> HapManager::FindResourceByHandle(ResourceHandleImpl &handle)
+{
+    std::lock_guard<std::mutex> handleLock(handle.mutex);
+    if (handle.isResolved && handle.resourceGeneration == resourceGeneration_.load()
+        && handle.configGeneration == configGeneration_.load()) {
+        return handle.idItem;
+    }
+    ReadLock lock(this->mutex_);
+    uint32_t resourceGeneration = resourceGeneration_.load();
+    if (!handle.isResolved || handle.resourceGeneration != resourceGeneration) {
+        if (handle.name.empty()) {
+            preloadRecorder_.Record(handle.id);
+        }
+        handle.candidates = handle.name.empty() ? this->GetResourceList(handle.id)
+            : this->GetResourceListByName(handle.name.c_str(), handle.resType);
+    }
+    handle.idItem = nullptr;
+    if (!handle.candidates.empty()) {
+        auto qualifierValue = this->GetBestMatchResource(handle.candidates, ScreenDensity::SCREEN_DENSITY_NOT_SET,
+            handle.isOverride);
+        if (qualifierValue != nullptr) {
+            handle.idItem = qualifierValue->GetIdItem();
+        }
+    }
+    handle.isResolved = true;
+    handle.resourceGeneration = resourceGeneration;
+    handle.configGeneration = configGeneration_.load();
+    return handle.idItem;
+}
+
 std::shared_ptr<ResConfigImpl> HapManager::getCompleteOverrideConfig(bool isGetOverrideResource)
 {
     if (!isGetOverrideResource) {
@@ -274,6 +342,10 @@ void HapManager::MatchBestResource(std::shared_ptr<ResConfigImpl> &bestResConfig
             result = paths[i];
             continue;
         }
+        // the configs of equal qualifiers are pooled, an equal config is never more suitable than the best one
+        if (bestResConfig == resConfig) {
+            continue;
+        }
         if (!bestResConfig->IsMoreSuitable(resConfig, currentResConfig, density)) {
             bestResConfig = resConfig;
             result = paths[i];
@@ -284,14 +356,21 @@ void HapManager::MatchBestResource(std::shared_ptr<ResConfigImpl> &bestResConfig
 const std::shared_ptr<ValueUnderQualifierDir> HapManager::GetBestMatchResource(
     const std::vector<std::shared_ptr<IdValues>> &candidates, uint32_t density, bool isGetOverrideResource)
 {
-    std::shared_ptr<ResConfigImpl> bestResConfig = nullptr;
-    std::shared_ptr<ResConfigImpl> bestOverlayResConfig = nullptr;
-    std::shared_ptr<ValueUnderQualifierDir> result = nullptr;
-    std::shared_ptr<ValueUnderQualifierDir> overlayResult = nullptr;
     const std::shared_ptr<ResConfigImpl> currentResConfig = getCompleteOverrideConfig(isGetOverrideResource);
     if (!currentResConfig) {
         return nullptr;
     }
+    return GetBestMatchResource(candidates, density, currentResConfig);
+}
+
+const std::shared_ptr<ValueUnderQualifierDir> HapManager::GetBestMatchResource(
+    const std::vector<std::shared_ptr<IdValues>> &candidates, uint32_t density,
+    const std::shared_ptr<ResConfigImpl> &currentResConfig)
+{
+    std::shared_ptr<ResConfigImpl> bestResConfig = nullptr;
+    std::shared_ptr<ResConfigImpl> bestOverlayResConfig = nullptr;
+    std::shared_ptr<ValueUnderQualifierDir> result = nullptr;
+    std::shared_ptr<ValueUnderQualifierDir> overlayResult = nullptr;
     // When there are multiple overlays, reverse the search to find the first match resource.
     for (auto iter = candidates.rbegin(); iter != candidates.rend(); iter++) {
         const auto &paths = (*iter)->GetLimitPathsConst();
@@ -361,10 +440,45 @@ RState HapManager::FindRawFile(const std::string &name, std::string &outValue)
 
 RState HapManager::UpdateResConfig(ResConfig &resConfig)
 {
+    uint32_t changes = CONFIG_CHANGE_NONE;
+    return UpdateResConfig(resConfig, changes);
+}
+
+void HapManager::PrepareLocaleUpdate(bool isOverride, ResConfig &resConfig)
+{
+    std::shared_ptr<ResConfigImpl> config = std::make_shared<ResConfigImpl>();
+    std::vector<std::shared_ptr<HapResource>> hapResources;
+    {
+        ReadLock lock(this->mutex_);
+        const std::shared_ptr<ResConfigImpl> &currentConfig = isOverride ? this->overrideResConfig_ : this->resConfig_;
+        if (currentConfig->MatchLocal(resConfig) || !config->Copy(*currentConfig, true)) {
+            return;
+        }
+        hapResources = hapResources_;
+    }
+    // the config the resources are filtered with once resConfig is copied under the write lock
+    if (!config->Copy(resConfig)) {
+        return;
+    }
+    for (auto &resource : hapResources) {
+        resource->PrepareUpdate(config);
+    }
+}
+
+RState HapManager::UpdateResConfig(ResConfig &resConfig, uint32_t &changes)
+{
+    PrepareLocaleUpdate(false, resConfig);
     WriteLock lock(this->mutex_);
-    bool needUpdate = !this->resConfig_->MatchLocal(resConfig);
+    changes = this->resConfig_->Diff(resConfig);
+    if (changes == CONFIG_CHANGE_NONE) {
+        return SUCCESS;
+    }
+    bool needUpdate = (changes & CONFIG_CHANGE_LOCALE) != 0 && !this->resConfig_->MatchLocal(resConfig);
     this->resConfig_->Copy(resConfig);
+    lastConfigChanges_ = changes;
+    configGeneration_++;
     if (needUpdate) {
+        resourceGeneration_++;
         for (auto &resource : hapResources_) {
             RState state = resource->Update(this->resConfig_);
             if (state != SUCCESS) {
@@ -377,10 +491,18 @@ RState HapManager::UpdateResConfig(ResConfig &resConfig)
 
 RState HapManager::UpdateOverrideResConfig(ResConfig &resConfig)
 {
+    PrepareLocaleUpdate(true, resConfig);
     WriteLock lock(this->mutex_);
-    bool needUpdate = !this->overrideResConfig_->MatchLocal(resConfig);
+    uint32_t changes = this->overrideResConfig_->Diff(resConfig);
+    if (changes == CONFIG_CHANGE_NONE) {
+        return SUCCESS;
+    }
+    bool needUpdate = (changes & CONFIG_CHANGE_LOCALE) != 0 && !this->overrideResConfig_->MatchLocal(resConfig);
     this->overrideResConfig_->Copy(resConfig);
+    lastConfigChanges_ = changes;
+    configGeneration_++;
     if (needUpdate) {
+        resourceGeneration_++;
         for (auto &resource : hapResources_) {
             RState state = resource->Update(this->overrideResConfig_);
             if (state != SUCCESS) {
@@ -424,35 +546,77 @@ void HapManager::GetOverrideResConfig(ResConfig &resConfig)
     resConfig.Copy(*(this->overrideResConfig_));
 }
 
+std::shared_ptr<ResConfigImpl> HapManager::GetLoadConfigSnapshot(uint32_t &configGeneration)
+{
+    configGeneration = configGeneration_.load();
+    std::shared_ptr<ResConfigImpl> config = getCompleteOverrideConfig(isOverride_);
+    if (config == nullptr || isOverride_) {
+        return config;
+    }
+    // the load runs without the lock, so it must not share resConfig_ with UpdateResConfig
+    std::shared_ptr<ResConfigImpl> snapshot = std::make_shared<ResConfigImpl>();
+    if (!snapshot->Copy(*config, true)) {
+        RESMGR_HILOGE(RESMGR_TAG, "GetLoadConfigSnapshot copy failed");
+        return nullptr;
+    }
+    return snapshot;
+}
+
+void HapManager::PublishHapResource(const std::shared_ptr<HapResource> &pResource, uint32_t configGeneration)
+{
+    if (configGeneration != configGeneration_.load()) {
+        // the configuration changed while loading, filter the resource again with the current one
+        std::shared_ptr<ResConfigImpl> config = getCompleteOverrideConfig(isOverride_);
+        pResource->Update(config);
+    }
+    this->hapResources_.push_back(pResource);
+    if (pResource->IsOverlayResource()) {
+        return;
+    }
+    if (pResource->HasDarkRes()) {
+        this->resConfig_->SetAppDarkRes(true);
+    }
+    if (!pResource->IsSystemResource() && pResource->IsThemeSystemResEnable()) {
+        this->isThemeSystemResEnable_ = true;
+    }
+}
+
 bool HapManager::AddResource(const char *path, const uint32_t &selectedTypes, bool forceReload)
 {
-    WriteLock lock(this->mutex_);
     std::string sPath(path);
 #if defined(__ARKUI_CROSS__)
     if (forceReload) {
+        WriteLock lock(this->mutex_);
         HapResourceManager::GetInstance().RemoveHapResource(sPath);
         RemoveHapResource(sPath);
     }
 #endif
-    auto it = loadedHapPaths_.find(sPath);
-    if (it != loadedHapPaths_.end()) {
+    uint32_t configGeneration = 0;
+    std::shared_ptr<ResConfigImpl> config;
+    {
+        ReadLock lock(this->mutex_);
+        if (loadedHapPaths_.find(sPath) != loadedHapPaths_.end()) {
+            return false;
+        }
+        config = GetLoadConfigSnapshot(configGeneration);
+    }
+    if (config == nullptr) {
         return false;
     }
-    std::shared_ptr<ResConfigImpl> config = getCompleteOverrideConfig(isOverride_);
+    // parse the hap without the lock, the readers of the loaded resources are not blocked meanwhile
     std::shared_ptr<HapResource> pResource =
         HapResourceManager::GetInstance().Load(path, config, isSystem_, false, selectedTypes);
     if (pResource == nullptr) {
         return false;
     }
-    this->loadedHapPaths_[sPath] = std::vector<std::string>();
-    this->hapResources_.push_back(pResource);
-    if (pResource->HasDarkRes()) {
-        this->resConfig_->SetAppDarkRes(true);
-    }
-    if (!pResource->IsSystemResource() && !pResource->IsOverlayResource()
-        && pResource->IsThemeSystemResEnable()) {
-        this->isThemeSystemResEnable_ = true;
+    WriteLock lock(this->mutex_);
+    if (loadedHapPaths_.find(sPath) != loadedHapPaths_.end()) {
+        RESMGR_HILOGD(RESMGR_TAG, "the hap has been added by another thread");
+        return false;
     }
+    this->loadedHapPaths_[sPath] = std::vector<std::string>();
+    PublishHapResource(pResource, configGeneration);
+    resourceGeneration_++;
     return true;
 }
 
@@ -469,36 +633,47 @@ bool HapManager::AddPatchResource(const char *path, const char *patchPath)
     return HapResourceManager::GetInstance().PutPatchResource(sPath, sPatchPath);
 }
 
+bool HapManager::IsOverlayLoaded(const std::string &path, const std::vector<std::string> &overlayPaths)
+{
+    auto it = loadedHapPaths_.find(path);
+    return it != loadedHapPaths_.end() && !it->second.empty() && it->second == overlayPaths;
+}
+
 bool HapManager::AddResource(const std::string &path, const std::vector<std::string> &overlayPaths)
 {
-    WriteLock lock(this->mutex_);
-    std::vector<std::string> targetOverlay = loadedHapPaths_[path];
-    if (!targetOverlay.empty() && targetOverlay == overlayPaths) {
-        RESMGR_HILOGI(RESMGR_TAG, "the overlay hap already been loaded");
-        return true;
+    uint32_t configGeneration = 0;
+    std::shared_ptr<ResConfigImpl> config;
+    {
+        ReadLock lock(this->mutex_);
+        if (IsOverlayLoaded(path, overlayPaths)) {
+            RESMGR_HILOGI(RESMGR_TAG, "the overlay hap already been loaded");
+            return true;
+        }
+        config = GetLoadConfigSnapshot(configGeneration);
+    }
+    if (config == nullptr) {
+        return false;
     }
-    std::shared_ptr<ResConfigImpl> config = getCompleteOverrideConfig(isOverride_);
     std::unordered_map<std::string, std::shared_ptr<HapResource>> result =
         HapResourceManager::GetInstance().LoadOverlays(path, overlayPaths, config, isSystem_);
     if (result.size() == 0) {
         return false;
     }
+    WriteLock lock(this->mutex_);
+    if (IsOverlayLoaded(path, overlayPaths)) {
+        RESMGR_HILOGI(RESMGR_TAG, "the overlay hap has been added by another thread");
+        return true;
+    }
     if (result.find(path) != result.end()) {
-        hapResources_.push_back(result[path]);
-        if (result[path]->HasDarkRes()) {
-            this->resConfig_->SetAppDarkRes(true);
-        }
-        if (!result[path]->IsSystemResource() && !result[path]->IsOverlayResource()
-            && result[path]->IsThemeSystemResEnable()) {
-            this->isThemeSystemResEnable_ = true;
-        }
+        PublishHapResource(result[path], configGeneration);
     }
     for (auto iter = overlayPaths.rbegin(); iter != overlayPaths.rend(); iter++) {
         if (result.find(*iter) != result.end()) {
-            hapResources_.push_back(result[*iter]);
+            PublishHapResource(result[*iter], configGeneration);
         }
     }
     loadedHapPaths_[path] = overlayPaths;
+    resourceGeneration_++;
     return true;
 }
 
@@ -601,9 +776,11 @@ std::vector<std::shared_ptr<IdValues>> HapManager::GetResourceListByName(const c
 #if defined(__ARKUI_CROSS__)
 void HapManager::RemoveHapResource(const std::string &path)
 {
+    ReleaseMappedFiles(path);
     for (auto iter = hapResources_.begin(); iter != hapResources_.end();) {
         if ((*iter)->GetIndexPath() == path) {
             iter = hapResources_.erase(iter);
+            resourceGeneration_++;
             break;
         } else {
             ++iter;
@@ -690,14 +867,34 @@ std::shared_ptr<AbilityBase::Extractor> GetAbilityExtractor(
 }
 #endif
 
+RState CopySharedData(const std::shared_ptr<const uint8_t[]> &data, size_t len, std::unique_ptr<uint8_t[]> &outValue)
+{
+    std::unique_ptr<uint8_t[]> tempData = std::make_unique<uint8_t[]>(len);
+    if (tempData == nullptr || memcpy_s(tempData.get(), len, data.get(), len) != EOK) {
+        RESMGR_HILOGE(RESMGR_TAG, "copy shared data failed");
+        return NOT_FOUND;
+    }
+    outValue = std::move(tempData);
+    return SUCCESS;
+}
+
 RState HapManager::GetProfileData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t &len,
     std::unique_ptr<uint8_t[]> &outValue)
 {
-#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
-    if (!Utils::ContainsTail(qualifierDir->GetIndexPath(), Utils::tailSet)) {
-        // Not support uncompress hap
+    if (qualifierDir == nullptr) {
         return NOT_FOUND;
     }
+    if (!Utils::ContainsTail(qualifierDir->GetIndexPath(), Utils::tailSet)) {
+        std::shared_ptr<const uint8_t[]> mappedData;
+        size_t mappedLen = 0;
+        RState state = GetMappedFileData(qualifierDir, ResType::PROF, mappedLen, mappedData);
+        if (state != SUCCESS || CopySharedData(mappedData, mappedLen, outValue) != SUCCESS) {
+            return NOT_FOUND;
+        }
+        len = mappedLen;
+        return SUCCESS;
+    }
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
     auto extractor = GetAbilityExtractor(qualifierDir);
     if (extractor == nullptr) {
         RESMGR_HILOGE(RESMGR_TAG, "failed to get extractor from ability");
@@ -720,14 +917,72 @@ RState HapManager::GetProfileData(const std::shared_ptr<ValueUnderQualifierDir>
 RState HapManager::GetMediaData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t &len,
     std::unique_ptr<uint8_t[]> &outValue)
 {
-    std::string filePath = qualifierDir->GetIndexPath();
-    RState state;
-    if (Utils::ContainsTail(filePath, Utils::tailSet)) {
-        state = HapManager::GetMediaDataFromHap(qualifierDir, len, outValue);
-    } else {
-        state = HapManager::GetMediaDataFromIndex(qualifierDir, len, outValue);
+    if (qualifierDir == nullptr) {
+        return NOT_FOUND;
     }
-    return state;
+    const std::shared_ptr<IdItem> idItem = qualifierDir->GetIdItem();
+    if (idItem == nullptr || idItem->resType_ != ResType::MEDIA) {
+        return NOT_FOUND;
+    }
+    std::string hapPath = qualifierDir->GetIndexPath();
+    std::shared_ptr<const uint8_t[]> sharedValue;
+    size_t sharedLen = 0;
+    if (!Utils::ContainsTail(hapPath, Utils::tailSet)) {
+        RState state = GetMappedFileData(qualifierDir, ResType::MEDIA, sharedLen, sharedValue);
+        if (state != SUCCESS || CopySharedData(sharedValue, sharedLen, outValue) != SUCCESS) {
+            return NOT_FOUND;
+        }
+        len = sharedLen;
+        return SUCCESS;
+    }
+    if (MediaCache::GetInstance().Get(hapPath, idItem->value_, sharedLen, sharedValue)) {
+        if (CopySharedData(sharedValue, sharedLen, outValue) != SUCCESS) {
+            return NOT_FOUND;
+        }
+        len = sharedLen;
+        return SUCCESS;
+    }
+    // the extracted buffer is handed out directly, the cache keeps its own copy only if the entry fits
+    RState state = HapManager::GetMediaDataFromHap(qualifierDir, len, outValue);
+    if (state != SUCCESS || outValue == nullptr || !MediaCache::GetInstance().IsCacheable(len)) {
+        return state;
+    }
+    std::unique_ptr<uint8_t[]> cacheData = std::make_unique<uint8_t[]>(len);
+    if (cacheData != nullptr && memcpy_s(cacheData.get(), len, outValue.get(), len) == EOK) {
+        MediaCache::GetInstance().Put(hapPath, idItem->value_, len,
+            std::shared_ptr<const uint8_t[]>(std::move(cacheData)));
+    }
+    return SUCCESS;
+}
+
+RState HapManager::GetMediaData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t &len,
+    std::shared_ptr<const uint8_t[]> &outValue)
+{
+    if (qualifierDir == nullptr) {
+        return NOT_FOUND;
+    }
+    const std::shared_ptr<IdItem> idItem = qualifierDir->GetIdItem();
+    if (idItem == nullptr || idItem->resType_ != ResType::MEDIA) {
+        return NOT_FOUND;
+    }
+    std::string hapPath = qualifierDir->GetIndexPath();
+    if (!Utils::ContainsTail(hapPath, Utils::tailSet)) {
+        // the mapped file is already shared, no need to keep another copy in the media cache
+        return GetMappedFileData(qualifierDir, ResType::MEDIA, len, outValue);
+    }
+    if (MediaCache::GetInstance().Get(hapPath, idItem->value_, len, outValue)) {
+        return SUCCESS;
+    }
+    std::unique_ptr<uint8_t[]> tempData;
+    size_t tempLen = 0;
+    RState state = HapManager::GetMediaDataFromHap(qualifierDir, tempLen, tempData);
+    if (state != SUCCESS || tempData == nullptr) {
+        return state;
+    }
+    len = tempLen;
+    outValue = std::shared_ptr<const uint8_t[]>(std::move(tempData));
+    MediaCache::GetInstance().Put(hapPath, idItem->value_, len, outValue);
+    return SUCCESS;
 }
 
 RState HapManager::GetMediaDataFromHap(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t &len,
@@ -756,16 +1011,56 @@ RState HapManager::GetMediaDataFromHap(const std::shared_ptr<ValueUnderQualifier
 
 RState HapManager::GetMediaDataFromIndex(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir, size_t &len,
     std::unique_ptr<uint8_t[]> &outValue)
+{
+    std::shared_ptr<const uint8_t[]> mappedData;
+    size_t mappedLen = 0;
+    RState state = GetMappedFileData(qualifierDir, ResType::MEDIA, mappedLen, mappedData);
+    if (state != SUCCESS || CopySharedData(mappedData, mappedLen, outValue) != SUCCESS) {
+        return NOT_FOUND;
+    }
+    len = mappedLen;
+    return SUCCESS;
+}
+
+RState HapManager::GetMappedFileData(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir,
+    const ResType resType, size_t &len, std::shared_ptr<const uint8_t[]> &outValue)
 {
     std::string filePath;
-    RState state = HapManager::GetFilePath(qualifierDir, ResType::MEDIA, filePath);
+    RState state = HapManager::GetFilePath(qualifierDir, resType, filePath);
     if (state != SUCCESS) {
         return NOT_FOUND;
     }
-    outValue = Utils::LoadResourceFile(filePath, len);
+    std::string indexPath = qualifierDir->GetIndexPath();
+    std::shared_ptr<MmapFile> mappedFile;
+    {
+        std::lock_guard<std::mutex> lock(mappedFilesLock_);
+        auto iter = mappedFiles_.find(indexPath);
+        if (iter != mappedFiles_.end() && iter->second.find(filePath) != iter->second.end()) {
+            mappedFile = iter->second[filePath];
+        }
+    }
+    if (mappedFile == nullptr) {
+        // map outside the lock, a concurrent mapping of the same file is dropped in favor of the cached one
+        mappedFile = MmapFile::MapReadOnly(filePath);
+        if (mappedFile == nullptr) {
+            RESMGR_HILOGE(RESMGR_TAG, "failed to map the resource file, resType = %{public}d", resType);
+            return NOT_FOUND;
+        }
+        std::lock_guard<std::mutex> lock(mappedFilesLock_);
+        auto result = mappedFiles_[indexPath].emplace(filePath, mappedFile);
+        mappedFile = result.first->second;
+    }
+    len = mappedFile->mmapLen_;
+    outValue = std::shared_ptr<const uint8_t[]>(mappedFile, mappedFile->mmap_);
     return SUCCESS;
 }
 
+void HapManager::ReleaseMappedFiles(const std::string &indexPath)
+{
+    std::lock_guard<std::mutex> lock(mappedFilesLock_);
+    mappedFiles_.erase(indexPath);
+}
+
 RState HapManager::GetMediaBase64Data(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir,
     std::string &outValue)
 {
@@ -857,6 +1152,14 @@ RState HapManager::FindRawFileFromHap(const std::string &rawFileName, size_t &le
             tempPatchPath = (*iter)->GetPatchPath();
         }
         if (Utils::ContainsTail(tempPath, Utils::tailSet)) { // if file path is compressed
+            std::shared_ptr<const uint8_t[]> cachedValue;
+            size_t cachedLen = 0;
+            if (hasPrefetchedRawFile_.load() &&
+                MediaCache::GetInstance().Get(tempPath, RAWFILE_CACHE_PREFIX + rawFileName, cachedLen, cachedValue) &&
+                CopySharedData(cachedValue, cachedLen, outValue) == SUCCESS) {
+                len = cachedLen;
+                return SUCCESS;
+            }
             RState state = HapParser::ReadRawFileFromHap(tempPath, tempPatchPath, rawFileName, len, outValue);
             if (state != SUCCESS) {
                 continue;
@@ -874,6 +1177,61 @@ RState HapManager::FindRawFileFromHap(const std::string &rawFileName, size_t &le
     return ERROR_CODE_RES_PATH_INVALID;
 }
 
+RState HapManager::PrefetchRawFile(const std::string &rawFileName)
+{
+    ReadLock lock(this->mutex_);
+    for (auto iter = hapResources_.begin(); iter != hapResources_.end(); iter++) {
+        if ((*iter)->IsSystemResource() || (*iter)->IsOverlayResource()) {
+            continue;
+        }
+        std::string tempPath = (*iter)->GetIndexPath();
+        if (!Utils::ContainsTail(tempPath, Utils::tailSet)) {
+            // the uncompressed raw file is read from file system directly, nothing to inflate
+            continue;
+        }
+        std::string tempPatchPath;
+        if ((*iter)->HasPatch()) {
+            tempPatchPath = (*iter)->GetPatchPath();
+        }
+        size_t len = 0;
+        std::unique_ptr<uint8_t[]> data;
+        RState state = HapParser::ReadRawFileFromHap(tempPath, tempPatchPath, rawFileName, len, data);
+        if (state != SUCCESS || data == nullptr) {
+            continue;
+        }
+        if (!MediaCache::GetInstance().IsCacheable(len)) {
+            RESMGR_HILOGD(RESMGR_TAG, "raw file too large to prefetch, len = %{public}zu", len);
+            return NOT_ENOUGH_MEM;
+        }
+        hasPrefetchedRawFile_ = true;
+        MediaCache::GetInstance().Put(tempPath, RAWFILE_CACHE_PREFIX + rawFileName, len,
+            std::shared_ptr<const uint8_t[]>(std::move(data)));
+        return SUCCESS;
+    }
+    return NOT_FOUND;
+}
+
+uint64_t HapManager::GetMediaDataOffset(const std::shared_ptr<ValueUnderQualifierDir> qualifierDir)
+{
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
+    if (qualifierDir == nullptr || !Utils::ContainsTail(qualifierDir->GetIndexPath(), Utils::tailSet)) {
+        return 0;
+    }
+    auto extractor = GetAbilityExtractor(qualifierDir);
+    if (extractor == nullptr) {
+        return 0;
+    }
+    std::string filePath = GetFilePathFromHap(extractor, qualifierDir, ResType::MEDIA);
+    AbilityBase::FileInfo fileInfo;
+    if (filePath.empty() || !extractor->GetFileInfo(filePath, fileInfo)) {
+        return 0;
+    }
+    return static_cast<uint64_t>(fileInfo.offset);
+#else
+    return 0;
+#endif
+}
+
 RState HapManager::FindRawFileDescriptorFromHap(const std::string &rawFileName,
     ResourceManager::RawFileDescriptor &descriptor)
 {
@@ -1080,7 +1438,9 @@ bool HapManager::RemoveResource(const std::string &path, const std::vector<std::
             }
             std::string hapPath = (*resIter)->GetIndexPath();
             if (hapPath == outPath) {
+                ReleaseMappedFiles(hapPath);
                 resIter = hapResources_.erase(resIter);
+                resourceGeneration_++;
             } else {
                 resIter++;
             }
@@ -1112,6 +1472,7 @@ void HapManager::AddSystemResource(const std::shared_ptr<HapManager> &systemHapM
     for (size_t i = 0; i < systemResources.size(); i++) {
         this->hapResources_.push_back(systemResources[i]);
     }
+    resourceGeneration_++;
 
     // add system loaded path to app loaded path map.
     const std::unordered_map<std::string, std::vector<std::string>> &loadedSystemPaths =
@@ -1308,6 +1669,7 @@ void HapManager::UpdateAppConfigForSysResManager(bool isAppDarkRes, bool isTheme
     if (this->isSystem_ && this->isUpdateAppConfig_) {
         this->isUpdateAppConfig_ = false;
         this->resConfig_->SetAppDarkRes(isAppDarkRes);
+        configGeneration_++;
         this->isThemeSystemResEnable_ = isThemeSystemResEnable;
     }
 }
@@ -29,6 +29,7 @@
 #include "hap_resource_v1.h"
 #include "hilog_wrapper.h"
 #include "locale_matcher.h"
+#include "res_config_pool.h"
 #if defined(__WINNT__)
 #include <cstring>
 #else
@@ -552,12 +553,35 @@ RState HapParser::IsRawDirUnCompressed(const std::string &pathName, bool &outVal
     return SUCCESS;
 }
 
+std::string HapParser::BuildResConfigPoolKey(const std::vector<std::shared_ptr<KeyParam>> &keyParams)
+{
+    std::string key;
+    key.reserve(keyParams.size() * (sizeof(uint8_t) + sizeof(uint32_t)));
+    for (const auto &kp : keyParams) {
+        key.push_back(static_cast<char>(kp->type_));
+        key.append(reinterpret_cast<const char *>(&kp->value_), sizeof(kp->value_));
+    }
+    return key;
+}
+
 std::shared_ptr<ResConfigImpl> HapParser::CreateResConfigFromKeyParams(
     const std::vector<std::shared_ptr<KeyParam>> &keyParams)
+{
+    // the same qualifiers repeat across the haps, so the config is created once and shared
+    std::string poolKey = BuildResConfigPoolKey(keyParams);
+    std::shared_ptr<ResConfigImpl> resConfig = ResConfigPool::GetInstance().Get(poolKey);
+    if (resConfig != nullptr) {
+        return resConfig;
+    }
+    return ResConfigPool::GetInstance().Put(poolKey, BuildResConfigFromKeyParams(keyParams));
+}
+
+std::shared_ptr<ResConfigImpl> HapParser::BuildResConfigFromKeyParams(
+    const std::vector<std::shared_ptr<KeyParam>> &keyParams)
 {
     auto resConfig = std::make_shared<ResConfigImpl>();
     if (resConfig == nullptr) {
-        RESMGR_HILOGE(RESMGR_TAG, "new ResConfigImpl failed when CreateResConfigFromKeyParams");
+        RESMGR_HILOGE(RESMGR_TAG, "new ResConfigImpl failed when BuildResConfigFromKeyParams");
         return nullptr;
     }
     size_t len = keyParams.size();
@@ -97,6 +97,63 @@ bool HapParserV1::Init(const char *path)
     return true;
 }
 
+bool HapParserV1::HasMatchedPendingKeys(const std::vector<std::shared_ptr<ResKey>> &pendingKeys)
+{
+    for (auto &key : pendingKeys) {
+        bool match = true;
+        if (!SkipParseItem(key, match)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HapParserV1::SetIndexData(std::unique_ptr<uint8_t[]> &buffer, size_t bufLen)
+{
+    buffer_ = std::move(buffer);
+    bufLen_ = bufLen;
+}
+
+bool HapParserV1::ParsePendingKeys(const char *path, std::vector<std::shared_ptr<ResKey>> &pendingKeys)
+{
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
+    HITRACE_METER_NAME_EX(HITRACE_LEVEL_INFO, HITRACE_TAG_APP, __PRETTY_FUNCTION__, nullptr);
+#endif
+    if (resDesc_ == nullptr) {
+        return false;
+    }
+    std::vector<std::shared_ptr<ResKey>> matchKeys;
+    std::vector<std::shared_ptr<ResKey>> remainKeys;
+    for (auto &key : pendingKeys) {
+        bool match = true;
+        if (SkipParseItem(key, match)) {
+            remainKeys.push_back(key);
+        } else {
+            matchKeys.push_back(key);
+        }
+    }
+    if (matchKeys.empty()) {
+        return true;
+    }
+    // the keys keep their offsets, so only the ids of the matched keys are parsed from the index read again
+    if (buffer_ == nullptr && !GetIndexData(path, buffer_, bufLen_)) {
+        return false;
+    }
+    for (auto &key : matchKeys) {
+        uint32_t idOffset = key->offset_;
+        std::shared_ptr<ResId> id = std::make_shared<ResId>();
+        int32_t ret = ParseId(idOffset, id);
+        if (ret != OK) {
+            RESMGR_HILOGE(RESMGR_TAG, "ParsePendingKeys failed! retcode:%d", ret);
+            return false;
+        }
+        key->resId_ = id;
+        resDesc_->keys_.push_back(key);
+    }
+    pendingKeys.swap(remainKeys);
+    return true;
+}
+
 int32_t HapParserV1::ParseResHex()
 {
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
@@ -161,6 +218,9 @@ int32_t HapParserV1::ParseKey(uint32_t &offset, std::shared_ptr<ResKey> key, boo
     }
     key->resConfig_ = HapParser::CreateResConfigFromKeyParams(keyParams);
     if (SkipParseItem(key, match)) {
+        if (IsLocaleDeferred(key, match)) {
+            pendingKeys_.push_back(key);
+        }
         match = false;
         return OK;
     }
@@ -251,7 +311,7 @@ bool HapParserV1::SkipParseItem(const std::shared_ptr<ResKey> &key, bool &match)
         return false;
     }
 
-    if (!key->resConfig_->GetLocaleInfo()) {
+    if (key->resConfig_->GetResLocale() == nullptr) {
         return isUpdate_;
     }
 
@@ -261,6 +321,21 @@ bool HapParserV1::SkipParseItem(const std::shared_ptr<ResKey> &key, bool &match)
     return true;
 }
 
+bool HapParserV1::IsLocaleDeferred(const std::shared_ptr<ResKey> &key, bool match)
+{
+    if (!match || loadAll_ || key->resConfig_->GetResLocale() == nullptr) {
+        return false;
+    }
+    if (defaultConfig_ == nullptr) {
+        return true;
+    }
+    // a key rejected by the other qualifiers of the selected types is not loaded by a locale switch either
+    if (selectedTypes_ != SELECT_ALL && !defaultConfig_->MatchExceptLocale(key->resConfig_, false)) {
+        return false;
+    }
+    return !defaultConfig_->MatchLocal(*key->resConfig_);
+}
+
 int32_t HapParserV1::ParseId(uint32_t &offset, std::shared_ptr<ResId> id)
 {
     if (offset + ResId::RESID_HEADER_LEN > bufLen_) {
@@ -418,6 +493,9 @@ std::shared_ptr<HapResource> HapParserV1::GetHapResource(const char *path, bool
     pResource->SetLimitKeysValue(limitKeyValue_);
     pResource->SetLocales(locales_);
     pResource->SetSelectedType(selectedTypes_);
+    if (!pendingKeys_.empty()) {
+        pResource->SetPendingKeys(pendingKeys_);
+    }
     return pResource;
 }
 } // namespace Resource
@@ -55,6 +55,7 @@ bool HapParserV2::Init(const char *path)
         RESMGR_HILOGE(RESMGR_TAG, "Init mmap file failed");
         return false;
     }
+    path_ = path;
 
     if (!this->GetIndexMmap(path)) {
         RESMGR_HILOGE(RESMGR_TAG, "GetIndexMmap failed when construct hapParser");
@@ -83,6 +84,20 @@ int32_t HapParserV2::ParseResHex()
     if (deviceType_ == std::string(TABLET_STR) || deviceType_ == std::string(TWOINONE_STR)) {
         deviceTypes_ = ResConfigImpl::GetAppSupportDeviceTypes();
     }
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
+    if (!tableCachePath_.empty()) {
+        tableCache_ = ResourceTableCache::Open(path_, tableCachePath_);
+        if (tableCache_ != nullptr && LoadKeysFromCache() == OK) {
+            return OK;
+        }
+        // fall back to parsing the resource index, the damaged cache is replaced below unless opened only
+        tableCache_ = nullptr;
+        keys_.clear();
+        locales_.clear();
+        limitKeyValue_ = 0;
+        hasDarkRes_ = false;
+    }
+#endif
     ret = this->ParseKeys(offset);
     if (ret != OK) {
         return ret;
@@ -97,9 +112,74 @@ int32_t HapParserV2::ParseResHex()
         RESMGR_HILOGE(RESMGR_TAG, "Parse ResHeader failed, resource data error.");
         return UNKNOWN_ERROR;
     }
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
+    BuildTableCache();
+#endif
     return OK;
 }
 
+int32_t HapParserV2::LoadKeysFromCache()
+{
+    std::vector<ResourceTableCache::Key> cacheKeys;
+    if (!tableCache_->GetKeys(cacheKeys)) {
+        return UNKNOWN_ERROR;
+    }
+    for (const ResourceTableCache::Key &cacheKey : cacheKeys) {
+        std::shared_ptr<KeyInfo> key = std::make_shared<KeyInfo>();
+        key->resConfigId_ = cacheKey.resConfigId;
+        key->keyParamsCount_ = static_cast<uint32_t>(cacheKey.params.size());
+        bool match = true;
+        std::string locale;
+        bool isLocale = false;
+        for (const auto &param : cacheKey.params) {
+            std::shared_ptr<KeyParam> keyParam = std::make_shared<KeyParam>();
+            keyParam->type_ = static_cast<KeyType>(param.first);
+            keyParam->value_ = param.second;
+            MatchKeyParam(keyParam, match);
+            GetKeyParamsLocales(keyParam, locale, isLocale);
+            key->params_.push_back(keyParam);
+        }
+        if (isLocale) {
+            locales_.emplace(locale);
+        }
+        int32_t ret = AddKey(key, match);
+        if (ret != OK) {
+            return ret;
+        }
+    }
+    return OK;
+}
+
+bool HapParserV2::BuildTableCache()
+{
+    if (tableCachePath_.empty() || tableCacheMode_ == OPEN_ONLY) {
+        return false;
+    }
+    bool result = false;
+    if (tableCacheMode_ == BUILD_ASYNC) {
+        result = ResourceTableCache::BuildAsync(path_, std::move(rawKeys_), idMap_, tableCachePath_);
+    } else {
+        result = ResourceTableCache::Build(path_, rawKeys_, idMap_, tableCachePath_);
+    }
+    rawKeys_.clear();
+    return result;
+}
+
+bool HapParserV2::PrepareTableCache(const std::string &path, const std::string &cachePath)
+{
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
+    HapParserV2 hapParser;
+    hapParser.SetTableCachePath(cachePath, BUILD_SYNC);
+    // the parse maps the cache if up to date, else builds it
+    if (!hapParser.Init(path.c_str())) {
+        return false;
+    }
+    return hapParser.tableCache_ != nullptr || ResourceTableCache::Open(path, cachePath) != nullptr;
+#else
+    return false;
+#endif
+}
+
 int32_t HapParserV2::ParseHeader(uint32_t &offset)
 {
     if (offset + ResIndexHeader::RES_HEADER_LEN > mMapFile_->mmapLen_) {
@@ -134,20 +214,37 @@ int32_t HapParserV2::ParseKeys(uint32_t &offset)
         if (ret != OK) {
             return ret;
         }
-        if (!match) {
-            continue;
-        }
-        keys_[key->resConfigId_] = HapParser::CreateResConfigFromKeyParams(key->params_);
-        if (keys_[key->resConfigId_] == nullptr) {
-            return SYS_ERROR;
+        if (!tableCachePath_.empty() && tableCacheMode_ != OPEN_ONLY) {
+            ResourceTableCache::Key rawKey;
+            rawKey.resConfigId = key->resConfigId_;
+            for (const auto &keyParam : key->params_) {
+                rawKey.params.emplace_back(static_cast<uint32_t>(keyParam->type_), keyParam->value_);
+            }
+            rawKeys_.push_back(std::move(rawKey));
         }
-        if (keys_[key->resConfigId_]->GetColorMode() == ColorMode::DARK) {
-            hasDarkRes_ = true;
+        ret = AddKey(key, match);
+        if (ret != OK) {
+            return ret;
         }
     }
     return OK;
 }
 
+int32_t HapParserV2::AddKey(std::shared_ptr<KeyInfo> key, bool match)
+{
+    if (!match) {
+        return OK;
+    }
+    keys_[key->resConfigId_] = HapParser::CreateResConfigFromKeyParams(key->params_);
+    if (keys_[key->resConfigId_] == nullptr) {
+        return SYS_ERROR;
+    }
+    if (keys_[key->resConfigId_]->GetColorMode() == ColorMode::DARK) {
+        hasDarkRes_ = true;
+    }
+    return OK;
+}
+
 int32_t HapParserV2::ParseIds(uint32_t &offset)
 {
     if (offset + IdsHeader::IDS_HEADER_LEN > mMapFile_->mmapLen_) {
@@ -373,6 +470,12 @@ int32_t HapParserV2::ParseKeyParam(uint32_t &offset, std::shared_ptr<KeyParam> k
         return SYS_ERROR;
     }
     offset += KeyParam::KEYPARAM_LEN;
+    MatchKeyParam(keyParam, match);
+    return OK;
+}
+
+void HapParserV2::MatchKeyParam(std::shared_ptr<KeyParam> keyParam, bool &match)
+{
     keyParam->InitStr();
 
     this->GetLimitKeyValue(keyParam->type_);
@@ -384,7 +487,6 @@ int32_t HapParserV2::ParseKeyParam(uint32_t &offset, std::shared_ptr<KeyParam> k
         match = false;
     }
 #endif
-    return OK;
 }
 
 void HapParserV2::GetLimitKeyValue(KeyType type)
@@ -398,7 +500,8 @@ void HapParserV2::GetLimitKeyValue(KeyType type)
 
 std::shared_ptr<HapResource> HapParserV2::GetHapResource(const char *path, bool isSystem, bool isOverlay)
 {
-    if (keys_.size() == 0 || idMap_.size() == 0 || typeNameMap_.size() == 0) {
+    if (keys_.size() == 0 ||
+        (tableCache_ == nullptr && (idMap_.size() == 0 || typeNameMap_.size() == 0))) {
         RESMGR_HILOGE(RESMGR_TAG, "Get Hap resource failed, parse data is empty.");
         return nullptr;
     }
@@ -419,6 +522,9 @@ std::shared_ptr<HapResource> HapParserV2::GetHapResource(const char *path, bool
         return nullptr;
     }
 
+    if (tableCache_ != nullptr && !isOverlay) {
+        pResource->SetTable(tableCache_);
+    }
     pResource->SetLimitKeysValue(limitKeyValue_);
     pResource->SetLocales(locales_);
     pResource->InitThemeSystemRes();
@@ -65,6 +65,11 @@ const std::shared_ptr<IdValues> HapResource::GetIdValuesByName(const std::string
     return nullptr;
 }
 
+uint32_t HapResource::GetResIdByName(const std::string &name, const ResType resType)
+{
+    return 0;
+}
+
 RState HapResource::Update(std::shared_ptr<ResConfigImpl> &defaultConfig)
 {
     return SUCCESS;
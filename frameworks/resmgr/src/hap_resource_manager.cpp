@@ -20,6 +20,9 @@
 #include "hap_parser_v1.h"
 #include "hap_parser_v2.h"
 #include "hilog_wrapper.h"
+#include "media_cache.h"
+#include "resource_prefetcher.h"
+#include "resource_table_cache.h"
 #include "utils/errors.h"
 #include "utils/utils.h"
 
@@ -66,6 +69,27 @@ bool IsNewModule(const char *path)
     return true;
 }
 
+std::string GetTableCachePath(const char *path, bool isSystem, bool isOverlay, uint32_t selectedTypes)
+{
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
+    // overlays are remapped to the ids of their target, and a partial load parses only a few types
+    if (isOverlay || selectedTypes != SELECT_ALL) {
+        return "";
+    }
+    // every process loads the same system resource, so its cache is shared between processes. The apps only open
+    // it, the privileged resource_table_builder writes it at boot. It is keyed on the file, the apps in the sandbox
+    // reach the file by other paths
+    const std::string &cacheDir = isSystem ? ResourceTableCache::SYSTEM_CACHE_DIR : ResourceTableCache::APP_CACHE_DIR;
+    if (!Utils::IsFileExist(cacheDir)) {
+        return "";
+    }
+    return isSystem ? ResourceTableCache::GetSharedCachePath(cacheDir, path) :
+        ResourceTableCache::GetCachePath(cacheDir, path);
+#else
+    return "";
+#endif
+}
+
 const std::shared_ptr<HapResource> HapResourceManager::Load(const char *path,
     std::shared_ptr<ResConfigImpl> &defaultConfig, bool isSystem, bool isOverlay, uint32_t selectedTypes)
 {
@@ -82,11 +106,16 @@ const std::shared_ptr<HapResource> HapResourceManager::Load(const char *path,
             return pResource;
         }
     }
+    // the hap is loaded for the first time or has been modified, drop the media read from the old file
+    MediaCache::GetInstance().Invalidate(path);
 
     std::unique_ptr<HapParser> hapParser = nullptr;
     bool isNewModule = IsNewModule(path);
     if (isNewModule) {
-        hapParser = std::make_unique<HapParserV2>();
+        std::unique_ptr<HapParserV2> hapParserV2 = std::make_unique<HapParserV2>();
+        hapParserV2->SetTableCachePath(GetTableCachePath(path, isSystem, isOverlay, selectedTypes),
+            isSystem ? HapParserV2::OPEN_ONLY : HapParserV2::BUILD_ASYNC);
+        hapParser = std::move(hapParserV2);
     } else {
         hapParser = std::make_unique<HapParserV1>(defaultConfig, selectedTypes, isSystem || isOverlay);
     }
@@ -111,44 +140,51 @@ const std::unordered_map<std::string, std::shared_ptr<HapResource>> HapResourceM
     const std::string &path, const std::vector<std::string> &overlayPaths,
     std::shared_ptr<ResConfigImpl> &defaultConfig, bool isSystem)
 {
-    std::unordered_map<std::string, std::shared_ptr<HapResource>> result;
-    do {
-        const std::shared_ptr<HapResource> targetResource = this->Load(path.c_str(), defaultConfig, isSystem);
-        if (targetResource == nullptr) {
-            RESMGR_HILOGE(RESMGR_TAG, "load target failed");
-            break;
-        }
-        result[path] = targetResource;
-        bool success = true;
-        std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> mapping =
-            targetResource->BuildNameTypeIdMapping();
-        for (auto iter = overlayPaths.begin(); iter != overlayPaths.end(); iter++) {
-            // load overlay hap, the isOverlay flag set true.
-            const std::shared_ptr<HapResource> overlayResource =
-                this->Load(iter->c_str(), defaultConfig, isSystem, true);
-            if (overlayResource == nullptr) {
-                success = false;
-                break;
+    // the overlays need the target only to remap their ids, so they are loaded on the bounded worker pool at the
+    // same time as the target. The overlays no worker has started when the target is loaded are loaded by the
+    // calling thread, so it never waits for the workers busy with other tasks.
+    std::vector<std::shared_ptr<OverlayLoad>> overlayLoads;
+    overlayLoads.reserve(overlayPaths.size());
+    for (const std::string &overlayPath : overlayPaths) {
+        auto overlayLoad = std::make_shared<OverlayLoad>();
+        overlayLoad->future = overlayLoad->promise.get_future();
+        overlayLoads.push_back(overlayLoad);
+        PrefetchWorkerPool::GetInstance().Submit([this, overlayLoad, overlayPath, defaultConfig, isSystem]() mutable {
+            if (!overlayLoad->isClaimed.exchange(true)) {
+                // load overlay hap, the isOverlay flag set true.
+                overlayLoad->promise.set_value(this->Load(overlayPath.c_str(), defaultConfig, isSystem, true));
             }
-            result[*iter] = overlayResource;
-        }
-
-        if (!success) {
-            RESMGR_HILOGE(RESMGR_TAG, "load overlay failed");
-            break;
+        });
+    }
+    const std::shared_ptr<HapResource> targetResource = this->Load(path.c_str(), defaultConfig, isSystem);
+    for (size_t i = 0; i < overlayLoads.size(); i++) {
+        if (!overlayLoads[i]->isClaimed.exchange(true)) {
+            overlayLoads[i]->promise.set_value(this->Load(overlayPaths[i].c_str(), defaultConfig, isSystem, true));
         }
-
-        for (auto iter = result.begin(); iter != result.end(); iter++) {
-            auto index = iter->first.find(path);
-            if (index == std::string::npos) {
-                iter->second->UpdateOverlayInfo(mapping);
-            }
+    }
+    std::unordered_map<std::string, std::shared_ptr<HapResource>> result;
+    bool success = true;
+    for (size_t i = 0; i < overlayLoads.size(); i++) {
+        std::shared_ptr<HapResource> overlayResource = overlayLoads[i]->future.get();
+        if (overlayResource == nullptr) {
+            success = false;
+            continue;
         }
-        return result;
-    } while (false);
-
-    result.clear();
-    return std::unordered_map<std::string, std::shared_ptr<HapResource>>();
+        result[overlayPaths[i]] = overlayResource;
+    }
+    if (targetResource == nullptr) {
+        RESMGR_HILOGE(RESMGR_TAG, "load target failed");
+        return std::unordered_map<std::string, std::shared_ptr<HapResource>>();
+    }
+    if (!success) {
+        RESMGR_HILOGE(RESMGR_TAG, "load overlay failed");
+        return std::unordered_map<std::string, std::shared_ptr<HapResource>>();
+    }
+    for (auto iter = result.begin(); iter != result.end(); iter++) {
+        iter->second->UpdateOverlayInfo(*targetResource);
+    }
+    result[path] = targetResource;
+    return result;
 }
 
 std::shared_ptr<HapResource> HapResourceManager::PutAndGetResource(const std::string &path,
@@ -198,6 +234,7 @@ void HapResourceManager::RemoveHapResource(const std::string &path)
     if (iter != hapResourceMap_.end()) {
         hapResourceMap_.erase(iter);
     }
+    MediaCache::GetInstance().Invalidate(path);
 }
 #endif
 } // namespace Resource
@@ -114,6 +114,12 @@ bool HapResourceV1::Init(std::shared_ptr<ResConfigImpl> &defaultConfig)
     return InitIdList(defaultConfig);
 }
 
+void HapResourceV1::SetPendingKeys(std::vector<std::shared_ptr<ResKey>> &pendingKeys)
+{
+    WriteLock lock(mutex_);
+    pendingKeys_.swap(pendingKeys);
+}
+
 bool HapResourceV1::IsSystemResource() const
 {
     return isSystem_;
@@ -156,6 +162,24 @@ RState HapResourceV1::Update(std::shared_ptr<ResConfigImpl> &defaultConfig)
     return this->UpdateResConfig(defaultConfig);
 }
 
+uint32_t HapResourceV1::GetResIdByName(const std::string &name, const ResType resType)
+{
+    ReadLock lock(mutex_);
+    if (static_cast<size_t>(resType) >= idValuesNameMap_.size()) {
+        return 0;
+    }
+    const auto &map = idValuesNameMap_[resType];
+    auto iter = map->find(name);
+    if (iter == map->end()) {
+        return 0;
+    }
+    const std::vector<std::shared_ptr<ValueUnderQualifierDir>> &limitPaths = iter->second->GetLimitPathsConst();
+    if (limitPaths.empty()) {
+        return 0;
+    }
+    return std::static_pointer_cast<ValueUnderQualifierDirV1>(limitPaths[0])->idItem_->id_;
+}
+
 std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> HapResourceV1::BuildNameTypeIdMapping()
 {
     ReadLock lock(mutex_);
@@ -184,8 +208,7 @@ void HapResourceV1::GetLocales(std::set<std::string> &outValue, bool includeSyst
     outValue.insert(locales_.begin(), locales_.end());
 }
 
-void HapResourceV1::UpdateOverlayInfo(
-    std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> &nameTypeId)
+void HapResourceV1::UpdateOverlayInfo(HapResource &target)
 {
     WriteLock lock(mutex_);
     if (isOverlay_ && isOverlayUpdated_) {
@@ -197,16 +220,10 @@ void HapResourceV1::UpdateOverlayInfo(
         if (limitPaths.size() > 0) {
             std::shared_ptr<ValueUnderQualifierDirV1> value =
                 std::static_pointer_cast<ValueUnderQualifierDirV1>(limitPaths[0]);
-            std::string name = value->idItem_->name_;
-            ResType type = value->idItem_->resType_;
-            if (nameTypeId.find(name) == nameTypeId.end()) {
+            uint32_t newId = target.GetResIdByName(value->idItem_->name_, value->idItem_->resType_);
+            if (newId == 0) {
                 continue;
             }
-            auto &typeId = nameTypeId[name];
-            if (typeId.find(type) == typeId.end()) {
-                continue;
-            }
-            uint32_t newId = typeId[type];
             for_each(limitPaths.begin(), limitPaths.end(), [&](auto &item) {
                 item->GetIdItem()->id_ = newId;
             });
@@ -234,7 +251,8 @@ bool HapResourceV1::InitIdList(std::shared_ptr<ResConfigImpl> &defaultConfig)
         }
     }
 #ifdef SUPPORT_GRAPHICS
-    if (defaultConfig && (defaultConfig->GetPreferredLocaleInfo() || defaultConfig->GetLocaleInfo())) {
+    if (defaultConfig &&
+        (defaultConfig->GetResPreferredLocale() != nullptr || defaultConfig->GetResLocale() != nullptr)) {
         std::shared_ptr<ResConfigImpl> currentConfig = std::make_shared<ResConfigImpl>();
         currentConfig->Copy(*defaultConfig);
         loadedConfig_.insert(currentConfig);
@@ -307,21 +325,25 @@ RState HapResourceV1::UpdateResConfig(std::shared_ptr<ResConfigImpl> &defaultCon
         return SUCCESS;
     }
 #ifdef SUPPORT_GRAPHICS
-    if (!defaultConfig->GetPreferredLocaleInfo() && !defaultConfig->GetLocaleInfo()) {
+    if (defaultConfig->GetResPreferredLocale() == nullptr && defaultConfig->GetResLocale() == nullptr) {
         return SUCCESS;
     }
 #endif
     WriteLock lock(mutex_);
-    for (auto &config : loadedConfig_) {
-        if (defaultConfig->MatchLocal(*config)) {
-            return SUCCESS;
-        }
+    // the index read for this update is dropped even if it is not used
+    std::unique_ptr<uint8_t[]> preparedIndex = std::move(preparedIndex_);
+    if (IsLocaleLoaded(defaultConfig)) {
+        return SUCCESS;
     }
 
+    // only the pending keys of the new locale are parsed, the index is not kept in memory between the switches
     HapParserV1 hapParser(defaultConfig, selectedTypes_, false, true);
+    if (preparedIndex != nullptr) {
+        hapParser.SetIndexData(preparedIndex, preparedIndexLen_);
+    }
     resDesc_ = std::make_shared<ResDesc>();
     hapParser.SetResDesc(resDesc_);
-    if (!hapParser.Init(indexPath_.c_str())) {
+    if (!pendingKeys_.empty() && !hapParser.ParsePendingKeys(indexPath_.c_str(), pendingKeys_)) {
         return HAP_INIT_FAILED;
     }
     if (!InitIdList(defaultConfig)) {
@@ -329,6 +351,44 @@ RState HapResourceV1::UpdateResConfig(std::shared_ptr<ResConfigImpl> &defaultCon
     }
     return SUCCESS;
 }
+
+bool HapResourceV1::IsLocaleLoaded(const std::shared_ptr<ResConfigImpl> &defaultConfig)
+{
+    for (auto &config : loadedConfig_) {
+        if (defaultConfig->MatchLocal(*config)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HapResourceV1::PrepareUpdate(std::shared_ptr<ResConfigImpl> &defaultConfig)
+{
+    if (isSystem_ || isOverlay_ || !defaultConfig) {
+        return;
+    }
+    {
+        ReadLock lock(mutex_);
+        if (preparedIndex_ != nullptr || pendingKeys_.empty() || IsLocaleLoaded(defaultConfig)) {
+            return;
+        }
+        HapParserV1 hapParser(defaultConfig, selectedTypes_, false, true);
+        if (!hapParser.HasMatchedPendingKeys(pendingKeys_)) {
+            return;
+        }
+    }
+    // read and inflate the index without the lock, the update under the lock only parses the matched keys
+    std::unique_ptr<uint8_t[]> buffer;
+    size_t bufLen = 0;
+    if (!HapParser::GetIndexData(indexPath_.c_str(), buffer, bufLen)) {
+        return;
+    }
+    WriteLock lock(mutex_);
+    if (preparedIndex_ == nullptr) {
+        preparedIndex_ = std::move(buffer);
+        preparedIndexLen_ = bufLen;
+    }
+}
 }
 }
 }
\ No newline at end of file
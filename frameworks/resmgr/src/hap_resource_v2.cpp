@@ -21,6 +21,7 @@
 #include <unistd.h>
 
 #include "hap_parser_v2.h"
+#include "resource_table_cache.h"
 
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
 #include "hitrace_meter.h"
@@ -99,6 +100,9 @@ bool HapResourceV2::IsOverlayResource() const
 const std::shared_ptr<IdValues> HapResourceV2::GetIdValues(const uint32_t id)
 {
     ReadLock lock(mutex_);
+    if (table_ != nullptr) {
+        return GetTableIdValues(id);
+    }
     if (idMap_.empty()) {
         RESMGR_HILOGE(RESMGR_TAG, "idMap_ is empty");
         return nullptr;
@@ -122,6 +126,9 @@ const std::shared_ptr<IdValues> HapResourceV2::GetIdValuesByName(
     const std::string name, const ResType resType)
 {
     ReadLock lock(mutex_);
+    if (table_ != nullptr) {
+        return GetTableIdValuesByName(name, resType);
+    }
     if (typeNameMap_.empty()) {
         RESMGR_HILOGE(RESMGR_TAG, "typeNameMap_ is empty");
         return nullptr;
@@ -146,9 +153,30 @@ const std::shared_ptr<IdValues> HapResourceV2::GetIdValuesByName(
     return iter->second;
 }
 
+uint32_t HapResourceV2::GetResIdByName(const std::string &name, const ResType resType)
+{
+    ReadLock lock(mutex_);
+    if (table_ != nullptr) {
+        ResourceTableCache::Item item;
+        return table_->FindByName(name, resType, item) ? item.id : 0;
+    }
+    auto mapIterator = typeNameMap_.find(resType);
+    if (mapIterator == typeNameMap_.end()) {
+        return 0;
+    }
+    auto iter = mapIterator->second.find(name);
+    if (iter == mapIterator->second.end() || iter->second == nullptr) {
+        return 0;
+    }
+    return iter->second->GetId();
+}
+
 std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> HapResourceV2::BuildNameTypeIdMapping()
 {
     ReadLock lock(mutex_);
+    if (table_ != nullptr) {
+        return BuildTableNameTypeIdMapping();
+    }
     std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> result;
     result.reserve(idMap_.size());
     for (const auto &item : idMap_) {
@@ -229,6 +257,88 @@ void HapResourceV2::InitThemeSystemRes()
     }
 }
 
+void HapResourceV2::SetTable(std::shared_ptr<ResourceTableCache> table)
+{
+    WriteLock lock(mutex_);
+    table_ = table;
+}
+
+std::shared_ptr<IdValuesV2> HapResourceV2::GetCachedIdValues(uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(tableMutex_);
+    auto iter = idMap_.find(id);
+    if (iter == idMap_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+std::shared_ptr<IdValuesV2> HapResourceV2::PutCachedIdValues(uint32_t id, uint32_t type, uint32_t offset,
+    const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(tableMutex_);
+    auto iter = idMap_.find(id);
+    if (iter != idMap_.end()) {
+        return iter->second;
+    }
+    std::shared_ptr<IdValuesV2> idValues = std::make_shared<IdValuesV2>(static_cast<ResType>(type), id, offset, name);
+    idValues->SetMMap(mMapFile_);
+    idMap_[id] = idValues;
+    return idValues;
+}
+
+std::shared_ptr<IdValues> HapResourceV2::GetParsedIdValues(const std::shared_ptr<IdValuesV2> &idValues)
+{
+    if (!idValues->IsParsed() && ParseLimitPaths(idValues) != OK) {
+        return nullptr;
+    }
+    if (idValues->GetLimitPathsConst().empty()) {
+        RESMGR_HILOGW(RESMGR_TAG, "by id=%{public}u limitPaths is empty", idValues->GetId());
+        return nullptr;
+    }
+    return idValues;
+}
+
+const std::shared_ptr<IdValues> HapResourceV2::GetTableIdValues(const uint32_t id)
+{
+    std::shared_ptr<IdValuesV2> idValues = GetCachedIdValues(id);
+    if (idValues == nullptr) {
+        ResourceTableCache::Item item;
+        if (!table_->FindById(id, item)) {
+            return nullptr;
+        }
+        idValues = PutCachedIdValues(item.id, item.type, item.offset, item.name);
+    }
+    return GetParsedIdValues(idValues);
+}
+
+const std::shared_ptr<IdValues> HapResourceV2::GetTableIdValuesByName(const std::string &name,
+    const ResType resType)
+{
+    ResourceTableCache::Item item;
+    if (!table_->FindByName(name, resType, item)) {
+        return nullptr;
+    }
+    std::shared_ptr<IdValuesV2> idValues = GetCachedIdValues(item.id);
+    if (idValues == nullptr) {
+        idValues = PutCachedIdValues(item.id, item.type, item.offset, item.name);
+    }
+    return GetParsedIdValues(idValues);
+}
+
+std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> HapResourceV2::BuildTableNameTypeIdMapping()
+{
+    std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> result;
+    result.reserve(table_->GetItemCount());
+    ResourceTableCache::Item item;
+    for (uint32_t i = 0; i < table_->GetItemCount(); i++) {
+        if (table_->GetItem(i, item)) {
+            result[item.name][static_cast<ResType>(item.type)] = item.id;
+        }
+    }
+    return result;
+}
+
 int32_t HapResourceV2::ParseLimitPaths(std::shared_ptr<IdValuesV2> idValue)
 {
     std::unique_lock<std::mutex> lock(idValuesMutex_);
@@ -351,8 +461,7 @@ bool OverlayResource::IsOverlayResource() const
     return true;
 }
 
-void OverlayResource::UpdateOverlayInfo(
-    std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> &nameTypeId)
+void OverlayResource::UpdateOverlayInfo(HapResource &target)
 {
     WriteLock lock(mutex_);
     if (isOverlayUpdated_) {
@@ -361,12 +470,11 @@ void OverlayResource::UpdateOverlayInfo(
     std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> newIdMap;
     newIdMap.reserve(idMap_.size());
     for (auto &item : idMap_) {
-        std::string name = item.second->GetName();
-        ResType type = item.second->GetResType();
-        if (nameTypeId.find(name) == nameTypeId.end() || nameTypeId[name].find(type) == nameTypeId[name].end()) {
+        // look up only the names the overlay defines, instead of mapping every resource of the target
+        uint32_t newId = target.GetResIdByName(item.second->GetName(), item.second->GetResType());
+        if (newId == 0) {
             continue;
         }
-        uint32_t newId = nameTypeId[name][type];
         item.second->SetId(newId);
         newIdMap[newId] = item.second;
     }
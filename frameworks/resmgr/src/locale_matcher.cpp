@@ -33,6 +33,22 @@ uint64_t LocaleMatcher::EN_QAAG_ENCODE = Utils::EncodeLocale("en", "Qaag", nullp
 uint64_t LocaleMatcher::ZH_HANT_MO_ENCODE = Utils::EncodeLocale("zh", "Hant", "MO");
 uint64_t LocaleMatcher::ZH_HK_ENCODE = Utils::EncodeLocale("zh", nullptr, "HK");
 uint32_t LocaleMatcher::HANT_ENCODE = Utils::EncodeScript("Hant");
+const uint64_t EN_LATN_ENCODE = Utils::EncodeLocale("en", "Latn", nullptr);
+const uint64_t EN_ENCODE = Utils::EncodeLocale("en", nullptr, nullptr);
+const uint64_t EN_001_ENCODE = Utils::EncodeLocale("en", nullptr, "001");
+const uint16_t US_REGION_ENCODE = Utils::EncodeRegion("US");
+
+/**
+ * @brief encode the language of one locale and the region of another, same as Utils::EncodeLocale does with the
+ * strings, but the encodings computed when the locales are built are used.
+ */
+uint64_t ComposeLanguageAndRegion(const ResLocale *language, const ResLocale *region)
+{
+    uint64_t languageEncode = (language == nullptr) ? LocaleMatcher::NULL_LOCALE :
+        (language->GetEncodedLocale() & ~(ResLocale::SCRIPT_MASK | ResLocale::REGION_MASK));
+    uint64_t regionEncode = (region == nullptr) ? LocaleMatcher::NULL_LOCALE : region->GetEncodedRegion();
+    return languageEncode | regionEncode;
+}
 
 bool IsContainRegion(uint64_t encodedLocale)
 {
@@ -242,14 +258,14 @@ int8_t CompareRegionWhenQaag(const ResLocale *current,
     const ResLocale *other,
     const ResLocale *request)
 {
-    if ((request != nullptr) && (Utils::EncodeLocale(request->GetLanguage(), request->GetScript(),
-        nullptr) == LocaleMatcher::EN_QAAG_ENCODE)) {
-        if ((current != nullptr) && (Utils::EncodeLocale(current->GetLanguage(), nullptr,
-            current->GetRegion()) == LocaleMatcher::EN_GB_ENCODE)) {
+    if ((request != nullptr) &&
+        ((request->GetEncodedLocale() & ~ResLocale::REGION_MASK) == LocaleMatcher::EN_QAAG_ENCODE)) {
+        if ((current != nullptr) &&
+            ((current->GetEncodedLocale() & ~ResLocale::SCRIPT_MASK) == LocaleMatcher::EN_GB_ENCODE)) {
             return 1;
         }
-        if ((other != nullptr) && (Utils::EncodeLocale(other->GetLanguage(), nullptr, other->GetRegion()) ==
-            LocaleMatcher::EN_GB_ENCODE)) {
+        if ((other != nullptr) &&
+            ((other->GetEncodedLocale() & ~ResLocale::SCRIPT_MASK) == LocaleMatcher::EN_GB_ENCODE)) {
             return -1;
         }
     }
@@ -313,10 +329,8 @@ bool CompareScript(const ResLocale *current, const ResLocale *other)
     }
     if (current != nullptr && other != nullptr) {
         // when current locale is en-Qaag is equal en-Latn
-        if (Utils::EncodeLocale(current->GetLanguage(), current->GetScript(), nullptr) ==
-            Utils::EncodeLocale("en", "Qaag", nullptr)) {
-            if (Utils::EncodeLocale(other->GetLanguage(), other->GetScript(), nullptr) ==
-                Utils::EncodeLocale("en", "Latn", nullptr)) {
+        if ((current->GetEncodedLocale() & ~ResLocale::REGION_MASK) == LocaleMatcher::EN_QAAG_ENCODE) {
+            if ((other->GetEncodedLocale() & ~ResLocale::REGION_MASK) == EN_LATN_ENCODE) {
                 return true;
             }
         }
@@ -395,10 +409,8 @@ int8_t CompareWhenRegionIsNull(uint16_t currentEncodedRegion, uint16_t otherEnco
         return -1;
     }
     // current and other region is not null.alphabetically
-    uint64_t currentEncodedLocale = Utils::EncodeLocale((request == nullptr) ? nullptr : request->GetLanguage(),
-        nullptr, (current == nullptr) ? nullptr : current->GetRegion());
-    uint64_t otherEncodedLocale = Utils::EncodeLocale(
-        (request == nullptr) ? nullptr : request->GetLanguage(), nullptr, other->GetRegion());
+    uint64_t currentEncodedLocale = ComposeLanguageAndRegion(request, current);
+    uint64_t otherEncodedLocale = ComposeLanguageAndRegion(request, other);
     return AlphabeticallyCompare(current, currentEncodedLocale, other, otherEncodedLocale);
 }
 
@@ -469,13 +481,11 @@ int8_t CompareRegion(const ResLocale *current, const ResLocale *other, const Res
     if (request == nullptr || request->GetRegion() == nullptr) {
         return CompareWhenRegionIsNull(currentEncodedRegion, otherEncodedRegion, current, other, request);
     }
-    uint64_t requestEncodedLocale = Utils::EncodeLocale(request->GetLanguage(), nullptr, request->GetRegion());
+    uint64_t requestEncodedLocale = request->GetEncodedLocale() & ~ResLocale::SCRIPT_MASK;
     uint64_t requestEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE] = {0, 0, 0, 0, 0};
     FindTrackPath(request, LocaleMatcher::TRACKPATH_ARRAY_SIZE, requestEncodedLocale, requestEncodedTrackPath);
-    uint64_t currentEncodedLocale = Utils::EncodeLocale(
-        request->GetLanguage(), nullptr, (current == nullptr) ? nullptr : current->GetRegion());
-    uint64_t otherEncodedLocale = Utils::EncodeLocale(
-        request->GetLanguage(), nullptr, (other == nullptr) ? nullptr : other->GetRegion());
+    uint64_t currentEncodedLocale = ComposeLanguageAndRegion(request, current);
+    uint64_t otherEncodedLocale = ComposeLanguageAndRegion(request, other);
     currentEncodedLocale = AdjustLocaleForRegion(currentEncodedLocale);
     otherEncodedLocale = AdjustLocaleForRegion(otherEncodedLocale);
     int8_t currentMatchDistance = SearchTrackPathDistance(
@@ -536,14 +546,9 @@ bool LocaleMatcher::Normalize(ResLocale *localeInfo)
     if (encodedScript == LocaleMatcher::NULL_SCRIPT) {
         return true;
     }
-    char *tempScript = new(std::nothrow) char[SCRIPT_ARRAY_LEN];
-    if (tempScript == nullptr) {
-        return false;
-    }
-    tempScript[SCRIPT_LEN] = '\0';
+    char tempScript[SCRIPT_ARRAY_LEN] = {0};
     Utils::DecodeScript(encodedScript, tempScript);
-    localeInfo->script_ = tempScript;
-    return true;
+    return localeInfo->SetScript(tempScript, SCRIPT_LEN) == SUCCESS;
 }
 
 int8_t CompareLanguageIgnoreOldNewCode(const ResLocale *current, const ResLocale *other, const ResLocale *request)
@@ -562,16 +567,16 @@ int8_t CompareLanguageIgnoreOldNewCode(const ResLocale *current, const ResLocale
 
 bool IsSimilarToUsEnglish(const ResLocale *localeInfo)
 {
-    uint64_t localeEncode = Utils::EncodeLocale("en", nullptr,
-        (localeInfo == nullptr) ? nullptr : localeInfo->GetRegion());
+    uint64_t localeEncode = EN_ENCODE | ((localeInfo == nullptr) ? LocaleMatcher::NULL_REGION :
+        localeInfo->GetEncodedRegion());
     uint64_t loclaeEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE] = {0, 0, 0, 0, 0};
     FindTrackPath(nullptr, LocaleMatcher::TRACKPATH_ARRAY_SIZE, localeEncode, loclaeEncodedTrackPath);
     uint8_t len = LocaleMatcher::TRACKPATH_ARRAY_SIZE;
     for (uint8_t i = 0; i < len; ++i) {
-        if (loclaeEncodedTrackPath[i] == Utils::EncodeLocale("en", nullptr, nullptr)) {
+        if (loclaeEncodedTrackPath[i] == EN_ENCODE) {
             return true;
         }
-        if (loclaeEncodedTrackPath[i] == Utils::EncodeLocale("en", nullptr, "001")) {
+        if (loclaeEncodedTrackPath[i] == EN_001_ENCODE) {
             return false;
         }
     }
@@ -585,15 +590,14 @@ bool CompareRegionWhenLangIsNotEqual(const ResLocale *current,
     if (qaagResult != 0) {
         return qaagResult;
     }
-    if (request != nullptr && (Utils::EncodeLanguage(request->GetLanguage())) == Utils::EncodeLanguage("en")) {
+    if (request != nullptr && (request->GetEncodedLocale() & ~(ResLocale::SCRIPT_MASK | ResLocale::REGION_MASK)) ==
+        EN_ENCODE) {
         // when request is en-us,empty region is better
-        if ((Utils::EncodeRegion(request->GetRegion())) == Utils::EncodeRegion("US")) {
+        if (request->GetEncodedRegion() == US_REGION_ENCODE) {
             if (current != nullptr) {
-                return (current->GetRegion() == nullptr) ||
-                            ((Utils::EncodeRegion(current->GetRegion())) == Utils::EncodeRegion("US"));
+                return (current->GetRegion() == nullptr) || (current->GetEncodedRegion() == US_REGION_ENCODE);
             } else {
-                return !(other->GetRegion() == nullptr ||
-                            ((Utils::EncodeRegion(other->GetRegion())) == Utils::EncodeRegion("US")));
+                return !(other->GetRegion() == nullptr || (other->GetEncodedRegion() == US_REGION_ENCODE));
             }
         } else if (IsSimilarToUsEnglish(request)) {
             if (current != nullptr) {
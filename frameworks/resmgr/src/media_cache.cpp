@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media_cache.h"
+
+#include "hilog_wrapper.h"
+
+#ifdef SUPPORT_API_METRICS
+#include "api_metrics_reporter.h"
+#endif
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+#ifdef ENABLE_API_METRICS
+const std::string MEDIA_CACHE_HIT_METRICS = "LocalizationKit.resourceManager.mediaCache.HitRatio";
+#endif
+
+MediaCache::MediaCache() : capacity_(DEFAULT_CAPACITY)
+{}
+
+MediaCache& MediaCache::GetInstance()
+{
+    static MediaCache instance;
+    return instance;
+}
+
+std::string MediaCache::BuildKey(const std::string &hapPath, const std::string &filePath)
+{
+    std::string key;
+    key.reserve(hapPath.size() + filePath.size() + 1);
+    key.append(hapPath).push_back('\0');
+    key.append(filePath);
+    return key;
+}
+
+bool MediaCache::Get(const std::string &hapPath, const std::string &filePath, size_t &len,
+    std::shared_ptr<const uint8_t[]> &outValue)
+{
+    bool isHit = false;
+    uint32_t lookups = 0;
+    uint32_t hits = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = entries_.find(BuildKey(hapPath, filePath));
+        if (iter != entries_.end()) {
+            lruList_.splice(lruList_.begin(), lruList_, iter->second);
+            len = iter->second->len;
+            outValue = iter->second->value;
+            hits_++;
+            pendingHits_++;
+            isHit = true;
+        } else {
+            misses_++;
+        }
+        if (++pendingLookups_ >= REPORT_INTERVAL) {
+            lookups = pendingLookups_;
+            hits = pendingHits_;
+            pendingLookups_ = 0;
+            pendingHits_ = 0;
+        }
+    }
+    if (lookups > 0) {
+        ReportHitRatio(lookups, hits);
+    }
+    return isHit;
+}
+
+void MediaCache::Put(const std::string &hapPath, const std::string &filePath, size_t len,
+    const std::shared_ptr<const uint8_t[]> &value)
+{
+    if (value == nullptr || len == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (len > capacity_ / MAX_ENTRY_RATIO) {
+        return;
+    }
+    std::string key = BuildKey(hapPath, filePath);
+    auto iter = entries_.find(key);
+    if (iter != entries_.end()) {
+        usedBytes_ -= iter->second->len;
+        lruList_.erase(iter->second);
+        entries_.erase(iter);
+    }
+    lruList_.push_front({key, hapPath, len, value});
+    entries_[key] = lruList_.begin();
+    usedBytes_ += len;
+    EvictLocked();
+}
+
+bool MediaCache::IsCacheable(size_t len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return len > 0 && len <= capacity_ / MAX_ENTRY_RATIO;
+}
+
+void MediaCache::Invalidate(const std::string &hapPath)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = lruList_.begin(); iter != lruList_.end();) {
+        if (iter->hapPath != hapPath) {
+            ++iter;
+            continue;
+        }
+        usedBytes_ -= iter->len;
+        entries_.erase(iter->key);
+        iter = lruList_.erase(iter);
+    }
+}
+
+void MediaCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    lruList_.clear();
+    entries_.clear();
+    usedBytes_ = 0;
+}
+
+void MediaCache::SetCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    EvictLocked();
+}
+
+MediaCache::Statistics MediaCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics statistics;
+    statistics.hits = hits_;
+    statistics.misses = misses_;
+    statistics.evictions = evictions_;
+    statistics.usedBytes = usedBytes_;
+    statistics.capacity = capacity_;
+    statistics.count = entries_.size();
+    return statistics;
+}
+
+void MediaCache::EvictLocked()
+{
+    while (usedBytes_ > capacity_ && !lruList_.empty()) {
+        const Entry &last = lruList_.back();
+        RESMGR_HILOGD(RESMGR_TAG, "media cache evict, len = %{public}zu", last.len);
+        usedBytes_ -= last.len;
+        entries_.erase(last.key);
+        lruList_.pop_back();
+        evictions_++;
+    }
+}
+
+void MediaCache::ReportHitRatio([[maybe_unused]] uint32_t lookups, [[maybe_unused]] uint32_t hits)
+{
+#ifdef ENABLE_API_METRICS
+    ApiMetricsReporter::ReportPercentage(MEDIA_CACHE_HIT_METRICS, hits * 100 / lookups); // 100 means percentage
+#endif
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -14,12 +14,16 @@
  */
 
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__)
+#include <cerrno>
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #endif
 #include <unistd.h>
 
 #include "mmap_file.h"
+#include "hilog_wrapper.h"
+#include "utils/utils.h"
 
 namespace OHOS {
 namespace Global {
@@ -48,6 +52,42 @@ MmapFile::~MmapFile()
     }
 #endif
 }
+
+std::shared_ptr<MmapFile> MmapFile::MapReadOnly(const std::string &path)
+{
+    auto mmapFile = std::make_shared<MmapFile>();
+#if !defined(__WINNT__) && !defined(__IDE_PREVIEW__)
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        RESMGR_HILOGD(RESMGR_TAG, "failed to open file, errno = %{public}d", errno);
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    size_t len = static_cast<size_t>(fileStat.st_size);
+    void *addr = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping remains valid after the fd is closed
+    close(fd);
+    if (addr == MAP_FAILED) {
+        RESMGR_HILOGE(RESMGR_TAG, "failed to mmap file, errno = %{public}d", errno);
+        return nullptr;
+    }
+    mmapFile->mmap_ = static_cast<uint8_t*>(addr);
+    mmapFile->mmapLen_ = len;
+#else
+    size_t len = 0;
+    std::unique_ptr<uint8_t[]> data = Utils::LoadResourceFile(path, len);
+    if (data == nullptr || len == 0) {
+        return nullptr;
+    }
+    mmapFile->mmap_ = data.release();
+    mmapFile->mmapLen_ = len;
+#endif
+    return mmapFile;
+}
 }
 }
 }
\ No newline at end of file
@@ -116,6 +116,70 @@ ResourceManager_ErrorCode copyString(char **resultValue, string tempResultValue,
     return ResourceManager_ErrorCode::SUCCESS;
 }
 
+ResourceManager_ErrorCode copyStringToBuffer(const string &tempResultValue, char *buffer, uint64_t bufferSize,
+    uint64_t *requiredSize, const char *apiName)
+{
+    size_t len = tempResultValue.size();
+    *requiredSize = static_cast<uint64_t>(len) + 1;
+    if (buffer == nullptr || bufferSize < *requiredSize) {
+        RESMGR_HILOGD(RESMGR_NATIVE_TAG, "%{public}s buffer too small, required size = %{public}zu",
+            apiName, len + 1);
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    if (len > 0 && memcpy_s(buffer, bufferSize, tempResultValue.data(), len) != EOK) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG, "%{public}s memcpy_s error", apiName);
+        return ResourceManager_ErrorCode::ERROR_CODE_OUT_OF_MEMORY;
+    }
+    buffer[len] = '\0';
+    return ResourceManager_ErrorCode::SUCCESS;
+}
+
+ResourceManager_ErrorCode copyStringArrayToArena(const vector<string> &tempResultValue, const char **resultValue,
+    uint32_t capacity, uint32_t *resultLen, char *arena, uint64_t arenaSize, uint64_t *requiredSize)
+{
+    uint64_t totalSize = 0;
+    for (const auto &value : tempResultValue) {
+        totalSize += static_cast<uint64_t>(value.size()) + 1;
+    }
+    *resultLen = static_cast<uint32_t>(tempResultValue.size());
+    *requiredSize = totalSize;
+    if (resultValue == nullptr || capacity < tempResultValue.size() || arena == nullptr || arenaSize < totalSize) {
+        RESMGR_HILOGD(RESMGR_NATIVE_TAG, "string array arena too small, count = %{public}zu, size = %{public}zu",
+            tempResultValue.size(), static_cast<size_t>(totalSize));
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    uint64_t offset = 0;
+    for (size_t i = 0; i < tempResultValue.size(); i++) {
+        uint64_t itemSize = 0;
+        ResourceManager_ErrorCode errorCode = copyStringToBuffer(tempResultValue[i], arena + offset,
+            arenaSize - offset, &itemSize, "GetStringArrayToArena");
+        if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+            return errorCode;
+        }
+        resultValue[i] = arena + offset;
+        offset += itemSize;
+    }
+    return ResourceManager_ErrorCode::SUCCESS;
+}
+
+ResourceManager_ErrorCode copyMediaToBuffer(const std::shared_ptr<const uint8_t[]> &data, size_t len,
+    uint8_t *buffer, uint64_t bufferSize, uint64_t *requiredSize)
+{
+    *requiredSize = static_cast<uint64_t>(len);
+    if (len == 0) {
+        return ResourceManager_ErrorCode::SUCCESS;
+    }
+    if (buffer == nullptr || bufferSize < len) {
+        RESMGR_HILOGD(RESMGR_NATIVE_TAG, "media buffer too small, required size = %{public}zu", len);
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    if (memcpy_s(buffer, bufferSize, data.get(), len) != EOK) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG, "media buffer memcpy_s error");
+        return ResourceManager_ErrorCode::ERROR_CODE_OUT_OF_MEMORY;
+    }
+    return ResourceManager_ErrorCode::SUCCESS;
+}
+
 ResourceManager_ErrorCode OH_ResourceManager_GetMediaBase64(const NativeResourceManager *mgr, uint32_t resId,
     char **resultValue, uint64_t *resultLen, uint32_t density)
 {
@@ -253,6 +317,69 @@ ResourceManager_ErrorCode OH_ResourceManager_GetMediaDataByName(const NativeReso
     return errorCode;
 }
 
+void ReleaseSharedMediaData(void *context)
+{
+    delete static_cast<std::shared_ptr<const uint8_t[]> *>(context);
+}
+
+ResourceManager_ErrorCode OutputSharedMediaData(const std::shared_ptr<const uint8_t[]> &data, size_t len,
+    const uint8_t **resultValue, uint64_t *resultLen, ResourceManager_ReleaseCallback *release, void **releaseContext)
+{
+    // the context holds a reference of the media data, the data is released when the callback is called
+    auto context = new (std::nothrow) std::shared_ptr<const uint8_t[]>(data);
+    if (context == nullptr) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG, "GetMediaDataView malloc error");
+        return ResourceManager_ErrorCode::ERROR_CODE_OUT_OF_MEMORY;
+    }
+    *resultValue = data.get();
+    *resultLen = static_cast<uint64_t>(len);
+    *release = ReleaseSharedMediaData;
+    *releaseContext = context;
+    return ResourceManager_ErrorCode::SUCCESS;
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaDataView(const NativeResourceManager *mgr, uint32_t resId,
+    const uint8_t **resultValue, uint64_t *resultLen, ResourceManager_ReleaseCallback *release,
+    void **releaseContext, uint32_t density)
+{
+    if (mgr == nullptr || resultValue == nullptr || resultLen == nullptr || release == nullptr ||
+        releaseContext == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+
+    std::shared_ptr<const uint8_t[]> tempResultValue;
+    size_t len = 0;
+    RState state = mgr->resManager->GetSharedMediaDataById(resId, len, tempResultValue, density);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get media view id = %{public}d, errorCode = %{public}d", resId, errorCode);
+        return errorCode;
+    }
+    return OutputSharedMediaData(tempResultValue, len, resultValue, resultLen, release, releaseContext);
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaDataViewByName(const NativeResourceManager *mgr,
+    const char *resName, const uint8_t **resultValue, uint64_t *resultLen, ResourceManager_ReleaseCallback *release,
+    void **releaseContext, uint32_t density)
+{
+    if (mgr == nullptr || resName == nullptr || resultValue == nullptr || resultLen == nullptr ||
+        release == nullptr || releaseContext == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+
+    std::shared_ptr<const uint8_t[]> tempResultValue;
+    size_t len = 0;
+    RState state = mgr->resManager->GetSharedMediaDataByName(resName, len, tempResultValue, density);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get media view name = %{public}s, errorCode = %{public}d", resName, errorCode);
+        return errorCode;
+    }
+    return OutputSharedMediaData(tempResultValue, len, resultValue, resultLen, release, releaseContext);
+}
+
 ResourceManager_ErrorCode OH_ResourceManager_GetDrawableDescriptor(const NativeResourceManager *mgr,
     uint32_t resId, ArkUI_DrawableDescriptor **drawableDescriptor, uint32_t density, uint32_t type)
 {
@@ -840,4 +967,229 @@ ResourceManager_ErrorCode OH_ResourceManager_GetDoublePluralStringByName(const N
         return errorCode;
     }
     return copyString(resultValue, tempResultValue, "GetDoublePluralStringByName");
+}
+
+bool GetBatchResType(ResourceManager_ResourceType type, ResType &resType)
+{
+    switch (type) {
+        case RESOURCE_TYPE_STRING:
+            resType = ResType::STRING;
+            return true;
+        case RESOURCE_TYPE_COLOR:
+            resType = ResType::COLOR;
+            return true;
+        case RESOURCE_TYPE_FLOAT:
+            resType = ResType::FLOAT;
+            return true;
+        case RESOURCE_TYPE_INT:
+            resType = ResType::INTEGER;
+            return true;
+        case RESOURCE_TYPE_BOOL:
+            resType = ResType::BOOLEAN;
+            return true;
+        default:
+            return false;
+    }
+}
+
+void OutputBatchItem(const ResourceManager::BatchItem &batchItem, ResourceManager_BatchItem &item, char *arena)
+{
+    item.errorCode = static_cast<ResourceManager_ErrorCode>(batchItem.state);
+    if (batchItem.state != RState::SUCCESS) {
+        return;
+    }
+    switch (batchItem.type) {
+        case ResType::STRING:
+            item.value.stringValue = arena + batchItem.stringOffset;
+            break;
+        case ResType::COLOR:
+            item.value.colorValue = batchItem.colorValue;
+            break;
+        case ResType::FLOAT:
+            item.value.floatValue = batchItem.floatValue;
+            break;
+        case ResType::INTEGER:
+            item.value.intValue = batchItem.intValue;
+            break;
+        default:
+            item.value.boolValue = batchItem.boolValue;
+            break;
+    }
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetResourcesByIds(const NativeResourceManager *mgr,
+    ResourceManager_BatchItem *items, uint32_t count, char *arena, uint64_t arenaSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || items == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::vector<ResourceManager::BatchItem> batchItems(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        batchItems[i].id = items[i].resId;
+        if (!GetBatchResType(items[i].type, batchItems[i].type)) {
+            RESMGR_HILOGE(RESMGR_NATIVE_TAG, "invalid batch item type = %{public}d", items[i].type);
+            return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+        }
+    }
+    std::string stringArena;
+    mgr->resManager->GetResourcesByIds(batchItems, stringArena);
+    *requiredSize = stringArena.size();
+    if (!stringArena.empty()) {
+        if (arena == nullptr || arenaSize < stringArena.size()) {
+            RESMGR_HILOGE(RESMGR_NATIVE_TAG, "batch arena too small, required size = %{public}zu",
+                stringArena.size());
+            return ResourceManager_ErrorCode::ERROR_CODE_OUT_OF_MEMORY;
+        }
+        if (memcpy_s(arena, arenaSize, stringArena.data(), stringArena.size()) != EOK) {
+            RESMGR_HILOGE(RESMGR_NATIVE_TAG, "batch arena memcpy error");
+            return ResourceManager_ErrorCode::ERROR_CODE_OUT_OF_MEMORY;
+        }
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        OutputBatchItem(batchItems[i], items[i], arena);
+    }
+    return ResourceManager_ErrorCode::SUCCESS;
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetStringToBuffer(const NativeResourceManager *mgr, uint32_t resId,
+    char *buffer, uint64_t bufferSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::string tempResultValue;
+    RState state = mgr->resManager->GetStringById(resId, tempResultValue);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get string id = %{public}d, errorCode = %{public}d", resId, errorCode);
+        return errorCode;
+    }
+    return copyStringToBuffer(tempResultValue, buffer, bufferSize, requiredSize, "GetStringToBuffer");
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetStringByNameToBuffer(const NativeResourceManager *mgr,
+    const char *resName, char *buffer, uint64_t bufferSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || resName == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::string tempResultValue;
+    RState state = mgr->resManager->GetStringByName(resName, tempResultValue);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get string name = %{public}s, errorCode = %{public}d", resName, errorCode);
+        return errorCode;
+    }
+    return copyStringToBuffer(tempResultValue, buffer, bufferSize, requiredSize, "GetStringByNameToBuffer");
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetPluralStringToBuffer(const NativeResourceManager *mgr,
+    uint32_t resId, uint32_t num, char *buffer, uint64_t bufferSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::string tempResultValue;
+    RState state = mgr->resManager->GetPluralStringByIdFormat(tempResultValue, resId, num, num);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get plural string id = %{public}d, errorCode = %{public}d", resId, errorCode);
+        return errorCode;
+    }
+    return copyStringToBuffer(tempResultValue, buffer, bufferSize, requiredSize, "GetPluralStringToBuffer");
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetPluralStringByNameToBuffer(const NativeResourceManager *mgr,
+    const char *resName, uint32_t num, char *buffer, uint64_t bufferSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || resName == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::string tempResultValue;
+    RState state = mgr->resManager->GetPluralStringByNameFormat(tempResultValue, resName, num, num);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get plural string name = %{public}s, errorCode = %{public}d", resName, errorCode);
+        return errorCode;
+    }
+    return copyStringToBuffer(tempResultValue, buffer, bufferSize, requiredSize, "GetPluralStringByNameToBuffer");
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetStringArrayToArena(const NativeResourceManager *mgr,
+    uint32_t resId, const char **resultValue, uint32_t capacity, uint32_t *resultLen, char *arena,
+    uint64_t arenaSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || resultLen == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::vector<std::string> tempResultValue;
+    RState state = mgr->resManager->GetStringArrayById(resId, tempResultValue);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get string array id = %{public}d, errorCode = %{public}d", resId, errorCode);
+        return errorCode;
+    }
+    return copyStringArrayToArena(tempResultValue, resultValue, capacity, resultLen, arena, arenaSize,
+        requiredSize);
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetStringArrayByNameToArena(const NativeResourceManager *mgr,
+    const char *resName, const char **resultValue, uint32_t capacity, uint32_t *resultLen, char *arena,
+    uint64_t arenaSize, uint64_t *requiredSize)
+{
+    if (mgr == nullptr || resName == nullptr || resultLen == nullptr || requiredSize == nullptr ||
+        mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::vector<std::string> tempResultValue;
+    RState state = mgr->resManager->GetStringArrayByName(resName, tempResultValue);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get string array resName = %{public}s, errorCode = %{public}d", resName, errorCode);
+        return errorCode;
+    }
+    return copyStringArrayToArena(tempResultValue, resultValue, capacity, resultLen, arena, arenaSize,
+        requiredSize);
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaToBuffer(const NativeResourceManager *mgr, uint32_t resId,
+    uint8_t *buffer, uint64_t bufferSize, uint64_t *requiredSize, uint32_t density)
+{
+    if (mgr == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::shared_ptr<const uint8_t[]> tempResultValue;
+    size_t len = 0;
+    RState state = mgr->resManager->GetSharedMediaDataById(resId, len, tempResultValue, density);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get media resource id = %{public}d, errorCode = %{public}d", resId, errorCode);
+        return errorCode;
+    }
+    return copyMediaToBuffer(tempResultValue, len, buffer, bufferSize, requiredSize);
+}
+
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaByNameToBuffer(const NativeResourceManager *mgr,
+    const char *resName, uint8_t *buffer, uint64_t bufferSize, uint64_t *requiredSize, uint32_t density)
+{
+    if (mgr == nullptr || resName == nullptr || requiredSize == nullptr || mgr->resManager == nullptr) {
+        return ResourceManager_ErrorCode::ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::shared_ptr<const uint8_t[]> tempResultValue;
+    size_t len = 0;
+    RState state = mgr->resManager->GetSharedMediaDataByName(resName, len, tempResultValue, density);
+    ResourceManager_ErrorCode errorCode = static_cast<ResourceManager_ErrorCode>(state);
+    if (errorCode != ResourceManager_ErrorCode::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_NATIVE_TAG,
+            "failed get media resource name = %{public}s, errorCode = %{public}d", resName, errorCode);
+        return errorCode;
+    }
+    return copyMediaToBuffer(tempResultValue, len, buffer, bufferSize, requiredSize);
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "preload_recorder.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+void PreloadRecorder::Start(uint32_t durationMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    recorded_.clear();
+    ids_.clear();
+    deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(durationMs);
+    isRecording_ = durationMs > 0;
+}
+
+void PreloadRecorder::RecordSlow(uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!isRecording_) {
+        return;
+    }
+    if (std::chrono::steady_clock::now() >= deadline_ || ids_.size() >= MAX_RECORD_COUNT) {
+        isRecording_ = false;
+        return;
+    }
+    if (recorded_.insert(id).second) {
+        ids_.push_back(id);
+    }
+}
+
+std::vector<uint32_t> PreloadRecorder::GetIds()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ids_;
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -60,8 +60,6 @@ ResConfigImpl::ResConfigImpl()
     inputDevice_(INPUTDEVICE_NOT_SET),
 #ifdef SUPPORT_GRAPHICS
     resPreferredLocale_(nullptr),
-    preferredLocaleInfo_(nullptr),
-    localeInfo_(nullptr),
 #endif
     themeId_(0),
     isCompletedScript_(false),
@@ -83,17 +81,15 @@ RState ResConfigImpl::SetPreferredLocaleInfo(Locale &preferredLocaleInfo)
             this->resPreferredLocale_ = nullptr;
         }
 
-        if (this->preferredLocaleInfo_ != nullptr) {
-            delete this->preferredLocaleInfo_;
-            this->preferredLocaleInfo_ = nullptr;
-        }
+        std::atomic_store(&this->preferredLocaleInfo_, std::shared_ptr<const Locale>());
         return SUCCESS;
     }
     RState state = BuildResLocale(language, script, region, &this->resPreferredLocale_);
     if (state != SUCCESS) {
         return state;
     }
-    return BuildLocaleInfo(this->resPreferredLocale_, &this->preferredLocaleInfo_);
+    std::atomic_store(&this->preferredLocaleInfo_, std::shared_ptr<const Locale>());
+    return SUCCESS;
 }
 
 RState ResConfigImpl::SetLocaleInfo(Locale &localeInfo)
@@ -124,20 +120,36 @@ RState ResConfigImpl::BuildResLocale(const char *language, const char *script,
     return state;
 }
 
-RState ResConfigImpl::BuildLocaleInfo(const ResLocale *resLocale, Locale **localeInfo)
+std::shared_ptr<const Locale> ResConfigImpl::BuildLocaleInfo(const ResLocale *resLocale)
 {
     UErrorCode errCode = U_ZERO_ERROR;
     Locale temp  = icu::LocaleBuilder().setLanguage(resLocale->GetLanguage())
         .setRegion(resLocale->GetRegion()).setScript(resLocale->GetScript()).build(errCode);
     if (!U_SUCCESS(errCode)) {
-        return NOT_ENOUGH_MEM;
+        return nullptr;
+    }
+    return std::make_shared<const Locale>(temp);
+}
+
+const Locale *ResConfigImpl::GetOrBuildLocaleInfo(const ResLocale *resLocale,
+    std::shared_ptr<const Locale> &localeInfo)
+{
+    if (resLocale == nullptr) {
+        return nullptr;
     }
-    if (*localeInfo != nullptr) {
-        delete *localeInfo;
-        *localeInfo = nullptr;
+    std::shared_ptr<const Locale> current = std::atomic_load(&localeInfo);
+    if (current != nullptr) {
+        return current.get();
     }
-    *localeInfo = new Locale(temp);
-    return SUCCESS;
+    std::shared_ptr<const Locale> built = BuildLocaleInfo(resLocale);
+    if (built == nullptr) {
+        return nullptr;
+    }
+    // the shared configs may be read by several threads, the locale built first is kept
+    if (!std::atomic_compare_exchange_strong(&localeInfo, &current, built)) {
+        return current.get();
+    }
+    return built.get();
 }
 #endif
 
@@ -158,9 +170,8 @@ RState ResConfigImpl::SetLocaleInfo(const char *language,
     RState state = SUCCESS;
     if (Utils::IsStrEmpty(language)) {
         delete this->resLocale_;
-        delete this->localeInfo_;
         this->resLocale_ = nullptr;
-        this->localeInfo_ = nullptr;
+        std::atomic_store(&this->localeInfo_, std::shared_ptr<const Locale>());
         return state;
     }
     this->isCompletedScript_ = false;
@@ -168,10 +179,7 @@ RState ResConfigImpl::SetLocaleInfo(const char *language,
     if (state != SUCCESS) {
         return state;
     }
-    state = BuildLocaleInfo(this->resLocale_, &this->localeInfo_);
-    if (state != SUCCESS) {
-        return state;
-    }
+    std::atomic_store(&this->localeInfo_, std::shared_ptr<const Locale>());
     this->isCompletedScript_ = true;
     return state;
 #else
@@ -257,12 +265,12 @@ const ResLocale *ResConfigImpl::GetResPreferredLocale() const
 
 const Locale *ResConfigImpl::GetPreferredLocaleInfo() const
 {
-    return this->preferredLocaleInfo_;
+    return GetOrBuildLocaleInfo(this->resPreferredLocale_, this->preferredLocaleInfo_);
 }
 
 const Locale *ResConfigImpl::GetLocaleInfo() const
 {
-    return localeInfo_;
+    return GetOrBuildLocaleInfo(this->resLocale_, this->localeInfo_);
 }
 #endif
 
@@ -327,24 +335,45 @@ DeviceType ResConfigImpl::GetDeviceType() const
 }
 
 #ifdef SUPPORT_GRAPHICS
-bool ResConfigImpl::CopyLocale(Locale **currentLocaleInfo, ResLocale **currentResLocale,
+bool ResConfigImpl::CopyLocale(std::shared_ptr<const Locale> &currentLocaleInfo, ResLocale **currentResLocale,
+    const ResLocale *otherResLocale, const std::shared_ptr<const Locale> &otherLocaleInfo)
+{
+    if (otherResLocale == nullptr) {
+        delete *currentResLocale;
+        *currentResLocale = nullptr;
+        std::atomic_store(&currentLocaleInfo, std::shared_ptr<const Locale>());
+        return true;
+    }
+    if (*currentResLocale != nullptr &&
+        (*currentResLocale)->GetEncodedLocale() == otherResLocale->GetEncodedLocale()) {
+        return true;
+    }
+    ResLocale *temp = new(std::nothrow) ResLocale(*otherResLocale);
+    if (temp == nullptr) {
+        return false;
+    }
+    delete *currentResLocale;
+    *currentResLocale = temp;
+    // the ICU locale is immutable, so the copy shares it, and it is built on first access if not built yet
+    std::atomic_store(&currentLocaleInfo, otherLocaleInfo);
+    return true;
+}
+
+bool ResConfigImpl::CopyLocale(std::shared_ptr<const Locale> &currentLocaleInfo, ResLocale **currentResLocale,
     const Locale *otherLocaleInfo)
 {
     bool needCopy = false;
-    if (*currentLocaleInfo == nullptr && otherLocaleInfo != nullptr) {
+    if (*currentResLocale == nullptr && otherLocaleInfo != nullptr) {
         needCopy = true;
     }
-    if (*currentLocaleInfo != nullptr && otherLocaleInfo == nullptr) {
+    if (*currentResLocale != nullptr && otherLocaleInfo == nullptr) {
         delete *currentResLocale;
-        delete *currentLocaleInfo;
         *currentResLocale = nullptr;
-        *currentLocaleInfo = nullptr;
+        std::atomic_store(&currentLocaleInfo, std::shared_ptr<const Locale>());
         return true;
     }
     if (*currentResLocale != nullptr && otherLocaleInfo != nullptr) {
-        uint64_t encodedLocale = Utils::EncodeLocale(
-            (*currentResLocale)->GetLanguage(),
-            (*currentResLocale)->GetScript(), (*currentResLocale)->GetRegion());
+        uint64_t encodedLocale = (*currentResLocale)->GetEncodedLocale();
         uint64_t otherEncodedLocale = Utils::EncodeLocale(
             otherLocaleInfo->getLanguage(),
             otherLocaleInfo->getScript(), otherLocaleInfo->getCountry());
@@ -370,9 +399,8 @@ bool ResConfigImpl::CopyLocale(Locale **currentLocaleInfo, ResLocale **currentRe
             return false;
         }
         delete *currentResLocale;
-        delete *currentLocaleInfo;
         *currentResLocale = temp;
-        *currentLocaleInfo = new Locale(tempLocale);
+        std::atomic_store(&currentLocaleInfo, std::make_shared<const Locale>(tempLocale));
     }
     return true;
 }
@@ -381,14 +409,24 @@ bool ResConfigImpl::CopyLocale(Locale **currentLocaleInfo, ResLocale **currentRe
 #ifdef SUPPORT_GRAPHICS
 bool ResConfigImpl::CopyPreferredLocale(const ResConfig &other)
 {
-    return CopyLocale(&this->preferredLocaleInfo_, &this->resPreferredLocale_, other.GetPreferredLocaleInfo());
+    const ResConfigImpl *otherImpl = dynamic_cast<const ResConfigImpl *>(&other);
+    if (otherImpl != nullptr) {
+        return CopyLocale(this->preferredLocaleInfo_, &this->resPreferredLocale_, otherImpl->resPreferredLocale_,
+            std::atomic_load(&otherImpl->preferredLocaleInfo_));
+    }
+    return CopyLocale(this->preferredLocaleInfo_, &this->resPreferredLocale_, other.GetPreferredLocaleInfo());
 }
 #endif
 
 bool ResConfigImpl::CopyLocale(const ResConfig &other)
 {
 #ifdef SUPPORT_GRAPHICS
-    return CopyLocale(&this->localeInfo_, &this->resLocale_, other.GetLocaleInfo());
+    const ResConfigImpl *otherImpl = dynamic_cast<const ResConfigImpl *>(&other);
+    if (otherImpl != nullptr) {
+        return CopyLocale(this->localeInfo_, &this->resLocale_, otherImpl->resLocale_,
+            std::atomic_load(&otherImpl->localeInfo_));
+    }
+    return CopyLocale(this->localeInfo_, &this->resLocale_, other.GetLocaleInfo());
 #else
     return false;
 #endif
@@ -397,7 +435,7 @@ bool ResConfigImpl::CopyLocale(const ResConfig &other)
 bool ResConfigImpl::isLocaleInfoSet()
 {
 #ifdef SUPPORT_GRAPHICS
-    return localeInfo_ != nullptr;
+    return resLocale_ != nullptr;
 #endif
     return false;
 }
@@ -514,31 +552,104 @@ bool ResConfigImpl::Copy(ResConfig &other, bool isRead)
     return true;
 }
 
+#ifdef SUPPORT_GRAPHICS
+static bool IsSameResLocale(const ResLocale *current, const ResLocale *other)
+{
+    if (current == nullptr || other == nullptr) {
+        return current == other;
+    }
+    return current->GetEncodedLocale() == other->GetEncodedLocale();
+}
+
+static bool IsSameLocaleInfo(const ResLocale *current, const Locale *other)
+{
+    if (current == nullptr || other == nullptr) {
+        return current == nullptr && other == nullptr;
+    }
+    return current->GetEncodedLocale() ==
+        Utils::EncodeLocale(other->getLanguage(), other->getScript(), other->getCountry());
+}
+#endif
+
+uint32_t ResConfigImpl::Diff(const ResConfig &other) const
+{
+    uint32_t changes = CONFIG_CHANGE_NONE;
+#ifdef SUPPORT_GRAPHICS
+    const ResConfigImpl *otherImpl = dynamic_cast<const ResConfigImpl *>(&other);
+    if (otherImpl != nullptr) {
+        if (!IsSameResLocale(this->resLocale_, otherImpl->resLocale_) ||
+            !IsSameResLocale(this->resPreferredLocale_, otherImpl->resPreferredLocale_)) {
+            changes |= CONFIG_CHANGE_LOCALE;
+        }
+    } else if (!IsSameLocaleInfo(this->resLocale_, other.GetLocaleInfo()) ||
+        !IsSameLocaleInfo(this->resPreferredLocale_, other.GetPreferredLocaleInfo())) {
+        changes |= CONFIG_CHANGE_LOCALE;
+    }
+#endif
+    DeviceType otherDeviceType = other.GetDeviceType();
+    if (otherDeviceType == DEVICE_NOT_SET && this->GetDeviceType() != DEVICE_NOT_SET) {
+        // Copy takes an unset device type as the current device
+        otherDeviceType = ParseDeviceTypeStr(GetCurrentDeviceType());
+    }
+    if (this->GetDeviceType() != otherDeviceType) {
+        changes |= CONFIG_CHANGE_DEVICE_TYPE;
+    }
+    if (this->GetDirection() != other.GetDirection()) {
+        changes |= CONFIG_CHANGE_DIRECTION;
+    }
+    if (this->GetColorMode() != other.GetColorMode() || this->GetAppColorMode() != other.GetAppColorMode()) {
+        changes |= CONFIG_CHANGE_COLOR_MODE;
+    }
+    if (this->GetInputDevice() != other.GetInputDevice()) {
+        changes |= CONFIG_CHANGE_INPUT_DEVICE;
+    }
+    if (this->GetMcc() != other.GetMcc() || this->GetMnc() != other.GetMnc()) {
+        changes |= CONFIG_CHANGE_MCC_MNC;
+    }
+    if (this->GetScreenDensity() != other.GetScreenDensity()) {
+        changes |= CONFIG_CHANGE_DENSITY;
+    }
+    if (this->GetThemeId() != other.GetThemeId()) {
+        changes |= CONFIG_CHANGE_THEME;
+    }
+    return changes;
+}
+
 bool ResConfigImpl::MatchLocal(const ResConfig &other) const
 {
 #ifdef SUPPORT_GRAPHICS
-    auto localeInfo = other.GetPreferredLocaleInfo();
-    if (!localeInfo) {
-        localeInfo = other.GetLocaleInfo();
+    ResLocale resLocal;
+    const ResLocale *otherLocale = nullptr;
+    const ResConfigImpl *otherImpl = dynamic_cast<const ResConfigImpl *>(&other);
+    if (otherImpl != nullptr) {
+        otherLocale = otherImpl->resPreferredLocale_ != nullptr ? otherImpl->resPreferredLocale_ :
+            otherImpl->resLocale_;
+    } else {
+        auto localeInfo = other.GetPreferredLocaleInfo();
+        if (!localeInfo) {
+            localeInfo = other.GetLocaleInfo();
+        }
+        if (localeInfo) {
+            resLocal.CopyFromLocaleInfo(localeInfo);
+            otherLocale = &resLocal;
+        }
     }
-    if (!localeInfo) {
+    if (!otherLocale) {
         return true;
     }
-    if (localeInfo && !resLocale_) {
+    if (!resLocale_) {
         return false;
     }
-    ResLocale resLocal;
-    resLocal.CopyFromLocaleInfo(localeInfo);
 
     bool isPreferredLocaleMatch = false;
     if (this->resPreferredLocale_ != nullptr) {
         isPreferredLocaleMatch = true;
-        if (!LocaleMatcher::Match(this->resPreferredLocale_, &resLocal)) {
+        if (!LocaleMatcher::Match(this->resPreferredLocale_, otherLocale)) {
             return false;
         }
     }
 
-    if (!isPreferredLocaleMatch && !(LocaleMatcher::Match(this->resLocale_, &resLocal))) {
+    if (!isPreferredLocaleMatch && !(LocaleMatcher::Match(this->resLocale_, otherLocale))) {
         return false;
     }
 #endif
@@ -675,9 +786,6 @@ bool ResConfigImpl::Match(const std::shared_ptr<ResConfigImpl> other, bool isChe
     if (other == nullptr) {
         return false;
     }
-    if (!IsMccMncMatch(other->mcc_, other->mnc_)) {
-        return false;
-    }
 
     bool isPreferredLocaleMatch = false;
 #ifdef SUPPORT_GRAPHICS
@@ -692,6 +800,17 @@ bool ResConfigImpl::Match(const std::shared_ptr<ResConfigImpl> other, bool isChe
     if (!isPreferredLocaleMatch && !(LocaleMatcher::Match(this->resLocale_, other->GetResLocale()))) {
         return false;
     }
+    return MatchExceptLocale(other, isCheckDarkAdaptation);
+}
+
+bool ResConfigImpl::MatchExceptLocale(const std::shared_ptr<ResConfigImpl> other, bool isCheckDarkAdaptation) const
+{
+    if (other == nullptr) {
+        return false;
+    }
+    if (!IsMccMncMatch(other->mcc_, other->mnc_)) {
+        return false;
+    }
     if (!IsDirectionMatch(other->direction_)) {
         return false;
     }
@@ -917,14 +1036,6 @@ ResConfigImpl::~ResConfigImpl()
         delete resPreferredLocale_;
         resPreferredLocale_ = nullptr;
     }
-    if (localeInfo_ != nullptr) {
-        delete localeInfo_;
-        localeInfo_ = nullptr;
-    }
-    if (preferredLocaleInfo_ != nullptr) {
-        delete preferredLocaleInfo_;
-        preferredLocaleInfo_ = nullptr;
-    }
 #endif
 }
 
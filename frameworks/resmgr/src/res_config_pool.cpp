@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "res_config_pool.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+ResConfigPool& ResConfigPool::GetInstance()
+{
+    static ResConfigPool instance;
+    return instance;
+}
+
+std::shared_ptr<ResConfigImpl> ResConfigPool::Get(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = configs_.find(key);
+    if (iter == configs_.end()) {
+        return nullptr;
+    }
+    return iter->second.lock();
+}
+
+std::shared_ptr<ResConfigImpl> ResConfigPool::Put(const std::string &key,
+    const std::shared_ptr<ResConfigImpl> &resConfig)
+{
+    if (resConfig == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::weak_ptr<ResConfigImpl> &pooled = configs_[key];
+    std::shared_ptr<ResConfigImpl> existing = pooled.lock();
+    if (existing != nullptr) {
+        return existing;
+    }
+    pooled = resConfig;
+    if (configs_.size() >= pruneThreshold_) {
+        PruneLocked();
+    }
+    return resConfig;
+}
+
+size_t ResConfigPool::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto &iter : configs_) {
+        if (!iter.second.expired()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void ResConfigPool::PruneLocked()
+{
+    for (auto iter = configs_.begin(); iter != configs_.end();) {
+        if (iter->second.expired()) {
+            iter = configs_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    // prune again only after the pool doubles, so the cost is amortized over the puts
+    pruneThreshold_ = std::max(DEFAULT_PRUNE_THRESHOLD, configs_.size() * 2);
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -37,80 +37,58 @@ Locale *ResLocale::defaultLocale_ = nullptr;
 #endif
 std::mutex ResLocale::mutex_;
 
-ResLocale::ResLocale() : language_(nullptr), region_(nullptr), script_(nullptr)
+ResLocale::ResLocale()
 {
 }
 
 RState ResLocale::SetLanguage(const char *language, size_t len)
 {
-    if (len == 0) {
-        delete[] this->language_;
-        this->language_ = nullptr;
-        return SUCCESS;
-    }
-    char *temp = new(std::nothrow) char[len + 1];
-    if (temp == nullptr) {
-        return NOT_ENOUGH_MEM;
+    if (len >= LANGUAGE_CAPACITY) {
+        return ERROR;
     }
-    delete[] this->language_;
-    this->language_ = temp;
-    size_t i = 0;
-    while (i < len) {
-        *(temp + i) = tolower(*(language + i));
-        ++i;
+    for (size_t i = 0; i < len; ++i) {
+        this->language_[i] = tolower(language[i]);
     }
-    *(temp + len) = '\0';
+    this->language_[len] = '\0';
+    UpdateEncodedLocale();
     return SUCCESS;
 }
 
 RState ResLocale::SetRegion(const char *region, size_t len)
 {
-    if (len == 0) {
-        delete[] this->region_;
-        this->region_ = nullptr;
-        return SUCCESS;
-    }
-    char *temp = new(std::nothrow) char[len + 1];
-    if (temp == nullptr) {
-        return NOT_ENOUGH_MEM;
+    if (len >= REGION_CAPACITY) {
+        return ERROR;
     }
-    delete[] this->region_;
-    this->region_ = temp;
-    size_t i = 0;
-    while (i < len) {
-        *(temp + i) = toupper(*(region + i));
-        ++i;
+    for (size_t i = 0; i < len; ++i) {
+        this->region_[i] = toupper(region[i]);
     }
-    *(temp + len) = '\0';
+    this->region_[len] = '\0';
+    UpdateEncodedLocale();
     return SUCCESS;
 }
 
 RState ResLocale::SetScript(const char *script, size_t len)
 {
-    if (len == 0) {
-        delete[] this->script_;
-        this->script_ = nullptr;
-        return SUCCESS;
-    }
-    char *temp = new(std::nothrow) char[len + 1];
-    if (temp == nullptr) {
-        return NOT_ENOUGH_MEM;
+    if (len >= SCRIPT_CAPACITY) {
+        return ERROR;
     }
-    delete[] this->script_;
-    this->script_ = temp;
-    size_t i = 0;
-    while (i < len) {
+    for (size_t i = 0; i < len; ++i) {
         if (i == 0) {
-            *(temp + i) = toupper(*(script + i));
+            this->script_[i] = toupper(script[i]);
         } else {
-            *(temp + i) = tolower(*(script + i));
+            this->script_[i] = tolower(script[i]);
         }
-        ++i;
     }
-    *(temp + len) = '\0';
+    this->script_[len] = '\0';
+    UpdateEncodedLocale();
     return SUCCESS;
 }
 
+void ResLocale::UpdateEncodedLocale()
+{
+    this->encodedLocale_ = Utils::EncodeLocale(GetLanguage(), GetScript(), GetRegion());
+}
+
 RState ResLocale::Init(const char *language, size_t languageLen, const char *script, size_t scriptLen,
     const char *region, size_t regionLen)
 {
@@ -151,17 +129,17 @@ RState ResLocale::Copy(const ResLocale *other)
 
 const char *ResLocale::GetLanguage() const
 {
-    return this->language_;
+    return this->language_[0] == '\0' ? nullptr : this->language_;
 }
 
 const char *ResLocale::GetRegion() const
 {
-    return this->region_;
+    return this->region_[0] == '\0' ? nullptr : this->region_;
 }
 
 const char *ResLocale::GetScript() const
 {
-    return this->script_;
+    return this->script_[0] == '\0' ? nullptr : this->script_;
 }
 
 RState ProcessSubtag(const char *curPos, int32_t subTagLen, uint16_t &nextType, ParseResult &r)
@@ -347,20 +325,6 @@ bool ResLocale::UpdateDefault(const Locale &localeInfo, bool needNotify)
 
 ResLocale::~ResLocale()
 {
-    if (this->language_ != nullptr) {
-        delete[] this->language_;
-        this->language_ = nullptr;
-    }
-
-    if (this->script_ != nullptr) {
-        delete[] this->script_;
-        this->script_ = nullptr;
-    }
-
-    if (this->region_ != nullptr) {
-        delete[] this->region_;
-        this->region_ = nullptr;
-    }
 }
 
 #ifdef SUPPORT_GRAPHICS
@@ -30,6 +30,9 @@ constexpr int32_t INVALID_USER_ID = -1;
 constexpr int32_t DEFAULT_USER_ID = 100;
 }
 static std::map<std::string, std::shared_ptr<ResourceManager>> resMgrMap;
+// the resource managers of the loaded haps, the later ones of the same hap share their resources
+static std::mutex sharedResMgrLock;
+static std::unordered_map<std::string, std::weak_ptr<ResourceManagerImpl>> sharedResMgrMap;
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
 static std::mutex resMgrExtLock;
 static std::shared_ptr<ResourceManagerExtMgr> resMgrExtMgr = std::make_shared<ResourceManagerExtMgr>();
@@ -52,6 +55,54 @@ ResourceManager *CreateResourceManager(bool includeSystemRes)
     return impl;
 }
 
+std::string GetSharedResMgrKey(const std::string &bundleName, const std::string &moduleName,
+    const std::string &hapPath, const std::vector<std::string> &overlayPath, int32_t userId)
+{
+    std::string key = bundleName + '\n' + moduleName + '\n' + hapPath + '\n' + std::to_string(userId);
+    for (const auto &path : overlayPath) {
+        key.append(1, '\n').append(path);
+    }
+    return key;
+}
+
+std::shared_ptr<ResourceManagerImpl> GetSharedResourceManager(const std::string &key, const std::string &hapPath,
+    const std::vector<std::string> &overlayPath)
+{
+    std::shared_ptr<ResourceManagerImpl> sharedResMgr;
+    {
+        std::lock_guard<std::mutex> lock(sharedResMgrLock);
+        auto iter = sharedResMgrMap.find(key);
+        if (iter == sharedResMgrMap.end()) {
+            return nullptr;
+        }
+        sharedResMgr = iter->second.lock();
+        if (sharedResMgr == nullptr) {
+            sharedResMgrMap.erase(iter);
+            return nullptr;
+        }
+    }
+    // only share the resource manager after the hap and its overlays are added by its creator
+    auto loadedHapPaths = sharedResMgr->GetHapManager()->GetLoadedHapPaths();
+    auto loadedHap = loadedHapPaths.find(hapPath);
+    if (loadedHap == loadedHapPaths.end() || loadedHap->second != overlayPath) {
+        return nullptr;
+    }
+    return sharedResMgr->CloneSharedResourceManager(hapPath);
+}
+
+void PutSharedResourceManager(const std::string &key, const std::shared_ptr<ResourceManagerImpl> &resMgr)
+{
+    std::lock_guard<std::mutex> lock(sharedResMgrLock);
+    for (auto iter = sharedResMgrMap.begin(); iter != sharedResMgrMap.end();) {
+        if (iter->second.expired()) {
+            iter = sharedResMgrMap.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    sharedResMgrMap[key] = resMgr;
+}
+
 std::shared_ptr<ResourceManager> CreateResourceManagerDef(
     const std::string &bundleName, const std::string &moduleName,
     const std::string &hapPath, const std::vector<std::string> &overlayPath,
@@ -61,18 +112,25 @@ std::shared_ptr<ResourceManager> CreateResourceManagerDef(
         RESMGR_HILOGE(RESMGR_TAG, "bundleName or hapPath is empty when CreateResourceManagerDef");
         return nullptr;
     }
-    std::shared_ptr<ResourceManager> resourceManagerImpl(CreateResourceManager());
-    if (resourceManagerImpl == nullptr) {
-        RESMGR_HILOGE(RESMGR_TAG, "CreateResourceManagerDef failed bundleName = %{public}s moduleName = %{public}s",
-            bundleName.c_str(), moduleName.c_str());
-        return nullptr;
+    userId = (userId == INVALID_USER_ID) ? DEFAULT_USER_ID : userId;
+    std::string key = GetSharedResMgrKey(bundleName, moduleName, hapPath, overlayPath, userId);
+    std::shared_ptr<ResourceManagerImpl> resourceManagerImpl;
+    if (!hapPath.empty()) {
+        resourceManagerImpl = GetSharedResourceManager(key, hapPath, overlayPath);
     }
-    resourceManagerImpl->bundleInfo.first = bundleName;
-    resourceManagerImpl->bundleInfo.second = moduleName;
-    if (userId == INVALID_USER_ID) {
-        resourceManagerImpl->userId = DEFAULT_USER_ID;
-    } else {
+    if (resourceManagerImpl == nullptr) {
+        resourceManagerImpl.reset(static_cast<ResourceManagerImpl *>(CreateResourceManager()));
+        if (resourceManagerImpl == nullptr) {
+            RESMGR_HILOGE(RESMGR_TAG, "CreateResourceManagerDef failed bundleName = %{public}s moduleName = %{public}s",
+                bundleName.c_str(), moduleName.c_str());
+            return nullptr;
+        }
+        resourceManagerImpl->bundleInfo.first = bundleName;
+        resourceManagerImpl->bundleInfo.second = moduleName;
         resourceManagerImpl->userId = userId;
+        if (!hapPath.empty()) {
+            PutSharedResourceManager(key, resourceManagerImpl);
+        }
     }
     uint32_t currentId = resConfig.GetThemeId();
     auto themePackManager = ThemePackManager::GetThemePackManager();
@@ -30,6 +30,7 @@
 #endif
 #include "hilog_wrapper.h"
 #include "res_config.h"
+#include "resource_prefetcher.h"
 #include "securec.h"
 #include "system_resource_manager.h"
 #include "utils/common.h"
@@ -774,6 +775,12 @@ RState ResourceManagerImpl::GetThemeFloat(const std::shared_ptr<IdItem> idItem,
 {
     ResConfigImpl resConfig;
     GetResConfig(resConfig);
+    return GetThemeFloat(idItem, resConfig, outValue);
+}
+
+RState ResourceManagerImpl::GetThemeFloat(const std::shared_ptr<IdItem> idItem, const ResConfigImpl &resConfig,
+    float &outValue)
+{
     std::vector<std::shared_ptr<IdItem>> idItems;
     idItems.emplace_back(idItem);
     ProcessReference(idItem->value_, idItems);
@@ -784,7 +791,7 @@ RState ResourceManagerImpl::GetThemeFloat(const std::shared_ptr<IdItem> idItem,
     }
     std::string unit;
     RState state = ParseFloat(result.c_str(), outValue, unit);
-    return state == SUCCESS ? RecalculateFloat(unit, outValue) : state;
+    return state == SUCCESS ? RecalculateFloat(unit, outValue, resConfig) : state;
 }
 
 RState ResourceManagerImpl::GetThemeFloat(const std::shared_ptr<IdItem> idItem, float &outValue, std::string &unit)
@@ -884,7 +891,12 @@ RState ResourceManagerImpl::RecalculateFloat(const std::string &unit, float &res
 {
     ResConfigImpl rc;
     GetResConfig(rc);
-    float density = rc.GetScreenDensity();
+    return RecalculateFloat(unit, result, rc);
+}
+
+RState ResourceManagerImpl::RecalculateFloat(const std::string &unit, float &result, const ResConfigImpl &resConfig)
+{
+    float density = resConfig.GetScreenDensity();
     if (density == SCREEN_DENSITY_NOT_SET) {
         RESMGR_HILOGD(RESMGR_TAG, "RecalculateFloat srcDensity SCREEN_DENSITY_NOT_SET ");
         return SUCCESS;
@@ -1022,6 +1034,12 @@ RState ResourceManagerImpl::GetThemeColor(const std::shared_ptr<IdItem> idItem,
 {
     ResConfigImpl resConfig;
     GetResConfig(resConfig);
+    return GetThemeColor(idItem, resConfig, outValue);
+}
+
+RState ResourceManagerImpl::GetThemeColor(const std::shared_ptr<IdItem> idItem, const ResConfigImpl &resConfig,
+    uint32_t &outValue)
+{
     std::vector<std::shared_ptr<IdItem> > idItems;
     idItems.emplace_back(idItem);
     RState state = ProcessReference(idItem->value_, idItems);
@@ -1163,6 +1181,56 @@ RState ResourceManagerImpl::GetIntArray(const std::shared_ptr<IdItem> idItem, st
     return SUCCESS;
 }
 
+RState ResourceManagerImpl::GetSharedIntArrayById(uint32_t id, std::shared_ptr<const std::vector<int32_t>> &outValue)
+{
+    const std::shared_ptr<IdItem> idItem = hapManager_->FindResourceById(id, isOverrideResMgr_);
+    return GetSharedIntArray(idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetSharedIntArrayByName(const char *name,
+    std::shared_ptr<const std::vector<int32_t>> &outValue)
+{
+    const std::shared_ptr<IdItem> idItem = hapManager_->FindResourceByName(name, ResType::INTARRAY, isOverrideResMgr_);
+    return GetSharedIntArray(idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetSharedIntArray(const std::shared_ptr<IdItem> idItem,
+    std::shared_ptr<const std::vector<int32_t>> &outValue)
+{
+    if (idItem == nullptr || idItem->resType_ != ResType::INTARRAY) {
+        return NOT_FOUND;
+    }
+    uint64_t generation = GetResourceGeneration();
+    {
+        std::lock_guard<std::mutex> lock(intArrayCacheMutex_);
+        if (intArrayCacheGeneration_ != generation) {
+            intArrayCache_.clear();
+            intArrayCacheGeneration_ = generation;
+        }
+        auto iter = intArrayCache_.find(idItem->id_);
+        if (iter != intArrayCache_.end()) {
+            outValue = iter->second;
+            return SUCCESS;
+        }
+    }
+    std::vector<int> intArray;
+    RState state = GetIntArray(idItem, intArray);
+    if (state != SUCCESS) {
+        return state;
+    }
+    auto sharedArray = std::make_shared<const std::vector<int32_t>>(intArray.begin(), intArray.end());
+    std::lock_guard<std::mutex> lock(intArrayCacheMutex_);
+    // the config may be changed while resolving, the array is still returned but only cached for its generation
+    if (intArrayCacheGeneration_ == generation) {
+        if (intArrayCache_.size() >= MAX_INT_ARRAY_CACHE_SIZE) {
+            intArrayCache_.clear();
+        }
+        intArrayCache_[idItem->id_] = sharedArray;
+    }
+    outValue = sharedArray;
+    return SUCCESS;
+}
+
 RState ResourceManagerImpl::GetThemeById(uint32_t id, std::map<std::string, std::string> &outValue)
 {
     const std::shared_ptr<IdItem> idItem = hapManager_->FindResourceById(id, isOverrideResMgr_);
@@ -1333,6 +1401,9 @@ bool ResourceManagerImpl::AddResource(const char *path, const uint32_t &selected
         RESMGR_HILOGE(RESMGR_TAG, "AddResource path is empty.");
         return false;
     }
+    if (!forceReload && !sharedHapPath_.empty() && sharedHapPath_ == path) {
+        return true;
+    }
 #if defined(__ARKUI_CROSS__) || defined(__IDE_PREVIEW__)
     if (!isSystemResMgr_ && Utils::IsSystemPath(std::string(path))) {
         ResourceManagerImpl* systemResourceManager = SystemResourceManager::GetSystemResourceManager();
@@ -1438,8 +1509,12 @@ RState ResourceManagerImpl::UpdateResConfig(ResConfig &resConfig, bool isUpdateT
     if (state != SUCCESS) {
         return state;
     }
-    state = this->hapManager_->UpdateResConfig(resConfig);
-    UpdateSystemResourceResConfig();
+    // the changes are diffed once under the lock of the update
+    uint32_t changes = CONFIG_CHANGE_NONE;
+    state = this->hapManager_->UpdateResConfig(resConfig, changes);
+    if (changes != CONFIG_CHANGE_NONE) {
+        UpdateSystemResourceResConfig();
+    }
     return state;
 }
 
@@ -1584,6 +1659,281 @@ RState ResourceManagerImpl::GetMediaDataByName(const char *name, size_t &len, st
     return state == SUCCESS ? state : ERROR_CODE_RES_NOT_FOUND_BY_NAME;
 }
 
+RState ResourceManagerImpl::GetSharedMediaDataById(uint32_t id, size_t &len,
+    std::shared_ptr<const uint8_t[]> &outValue, uint32_t density)
+{
+    if (!IsDensityValid(density)) {
+        RESMGR_HILOGE(RESMGR_TAG, "density invalid");
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    auto qualifierDir = hapManager_->FindQualifierValueById(id, isOverrideResMgr_, density);
+    if (qualifierDir == nullptr) {
+        RESMGR_HILOGE(RESMGR_TAG, "GetSharedMediaDataById error id = %{public}d", id);
+        return ERROR_CODE_RES_ID_NOT_FOUND;
+    }
+
+    // find in theme
+    const std::shared_ptr<IdItem> idItem = qualifierDir->GetIdItem();
+    std::unique_ptr<uint8_t[]> themeValue;
+    if (GetThemeMedia(idItem, len, themeValue, density) == SUCCESS) {
+        outValue = std::move(themeValue);
+        return SUCCESS;
+    }
+
+    RState state = hapManager_->GetMediaData(qualifierDir, len, outValue);
+    return state == SUCCESS ? state : ERROR_CODE_RES_NOT_FOUND_BY_ID;
+}
+
+RState ResourceManagerImpl::GetSharedMediaDataByName(const char *name, size_t &len,
+    std::shared_ptr<const uint8_t[]> &outValue, uint32_t density)
+{
+    if (!IsDensityValid(density)) {
+        RESMGR_HILOGE(RESMGR_TAG, "density invalid");
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    auto qualifierDir = hapManager_->FindQualifierValueByName(name, ResType::MEDIA, isOverrideResMgr_, density);
+    if (qualifierDir == nullptr) {
+        RESMGR_HILOGD(RESMGR_TAG, "GetSharedMediaDataByName error name = %{public}s", name);
+        return ERROR_CODE_RES_NAME_NOT_FOUND;
+    }
+
+    const std::shared_ptr<IdItem> idItem = qualifierDir->GetIdItem();
+    std::unique_ptr<uint8_t[]> themeValue;
+    if (GetThemeMedia(idItem, len, themeValue, density) == SUCCESS) {
+        outValue = std::move(themeValue);
+        return SUCCESS;
+    }
+
+    RState state = hapManager_->GetMediaData(qualifierDir, len, outValue);
+    return state == SUCCESS ? state : ERROR_CODE_RES_NOT_FOUND_BY_NAME;
+}
+
+std::shared_ptr<ResourceManager::PrefetchHandle> ResourceManagerImpl::Prefetch(const PrefetchRequest &request)
+{
+    if (!IsDensityValid(request.density)) {
+        RESMGR_HILOGE(RESMGR_TAG, "density invalid");
+        return nullptr;
+    }
+    std::vector<PrefetchItem> items;
+    size_t failedCount = 0;
+    auto addMediaItem = [this, &items, &failedCount](const std::shared_ptr<ValueUnderQualifierDir> &qualifierDir) {
+        if (qualifierDir == nullptr) {
+            failedCount++;
+            return;
+        }
+        PrefetchItem item;
+        item.qualifierDir = qualifierDir;
+        item.hapPath = qualifierDir->GetIndexPath();
+        item.offset = hapManager_->GetMediaDataOffset(qualifierDir);
+        items.emplace_back(std::move(item));
+    };
+    for (uint32_t id : request.ids) {
+        addMediaItem(hapManager_->FindQualifierValueById(id, isOverrideResMgr_, request.density));
+    }
+    for (const std::string &name : request.names) {
+        addMediaItem(hapManager_->FindQualifierValueByName(name.c_str(), ResType::MEDIA, isOverrideResMgr_,
+            request.density));
+    }
+    for (const std::string &rawFile : request.rawFiles) {
+        PrefetchItem item;
+        item.rawFileName = rawFile;
+        items.emplace_back(std::move(item));
+    }
+    return ResourcePrefetcher::Prefetch(hapManager_, items, failedCount);
+}
+
+std::shared_ptr<ResourceManager::PrefetchHandle> ResourceManagerImpl::Preload(const std::vector<uint32_t> &ids)
+{
+    return ResourcePrefetcher::Preload(hapManager_, ids, isOverrideResMgr_);
+}
+
+void ResourceManagerImpl::StartPreloadRecord(uint32_t durationMs)
+{
+    hapManager_->StartPreloadRecord(durationMs);
+}
+
+std::vector<uint32_t> ResourceManagerImpl::GetPreloadRecord()
+{
+    return hapManager_->GetPreloadRecord();
+}
+
+RState ResourceManagerImpl::GetResourcesByIds(std::vector<BatchItem> &items, std::string &arena)
+{
+    std::vector<uint32_t> ids;
+    ids.reserve(items.size());
+    for (const auto &item : items) {
+        ids.emplace_back(item.id);
+    }
+    std::vector<std::shared_ptr<IdItem>> idItems;
+    ResConfigImpl resConfig;
+    if (!hapManager_->FindResourcesByIds(ids, idItems, resConfig, isOverrideResMgr_)) {
+        RESMGR_HILOGE(RESMGR_TAG, "GetResourcesByIds get config snapshot failed");
+        return ERROR;
+    }
+    bool isAllFound = true;
+    for (size_t i = 0; i < items.size(); ++i) {
+        items[i].state = GetBatchItem(idItems[i], resConfig, items[i], arena);
+        if (items[i].state != SUCCESS) {
+            isAllFound = false;
+        }
+    }
+    return isAllFound ? SUCCESS : NOT_FOUND;
+}
+
+std::shared_ptr<ResourceManager::ResourceHandle> ResourceManagerImpl::GetResourceHandle(uint32_t id)
+{
+    auto handle = std::make_shared<ResourceHandleImpl>(hapManager_, id, "", ResType::MAX_RES_TYPE,
+        isOverrideResMgr_);
+    if (hapManager_->FindResourceByHandle(*handle) == nullptr) {
+        RESMGR_HILOGE(RESMGR_TAG, "GetResourceHandle error id = %{public}d", id);
+        return nullptr;
+    }
+    return handle;
+}
+
+std::shared_ptr<ResourceManager::ResourceHandle> ResourceManagerImpl::GetResourceHandleByName(const char *name,
+    ResType type)
+{
+    if (name == nullptr) {
+        return nullptr;
+    }
+    auto handle = std::make_shared<ResourceHandleImpl>(hapManager_, 0, name, type, isOverrideResMgr_);
+    if (hapManager_->FindResourceByHandle(*handle) == nullptr) {
+        RESMGR_HILOGD(RESMGR_TAG, "GetResourceHandleByName error name = %{public}s", name);
+        return nullptr;
+    }
+    return handle;
+}
+
+RState ResourceManagerImpl::FindResourceByHandle(const std::shared_ptr<ResourceHandle> &handle,
+    std::shared_ptr<IdItem> &idItem)
+{
+    if (handle == nullptr) {
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    // the handles are only created by GetResourceHandle and GetResourceHandleByName
+    auto handleImpl = std::static_pointer_cast<ResourceHandleImpl>(handle);
+    if (handleImpl->hapManager.lock() != hapManager_ || handleImpl->isOverride != isOverrideResMgr_) {
+        RESMGR_HILOGE(RESMGR_TAG, "the resource handle belongs to other resource manager");
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    idItem = hapManager_->FindResourceByHandle(*handleImpl);
+    if (idItem == nullptr) {
+        RESMGR_HILOGE(RESMGR_TAG, "FindResourceByHandle error id = %{public}d", handleImpl->id);
+        return handleImpl->name.empty() ? ERROR_CODE_RES_ID_NOT_FOUND : ERROR_CODE_RES_NAME_NOT_FOUND;
+    }
+    return SUCCESS;
+}
+
+static RState GetHandleNotFoundState(const std::shared_ptr<ResourceManager::ResourceHandle> &handle)
+{
+    // only called after FindResourceByHandle checked the handle
+    return std::static_pointer_cast<ResourceHandleImpl>(handle)->name.empty() ? ERROR_CODE_RES_NOT_FOUND_BY_ID
+        : ERROR_CODE_RES_NOT_FOUND_BY_NAME;
+}
+
+RState ResourceManagerImpl::GetStringByHandle(const std::shared_ptr<ResourceHandle> &handle, std::string &outValue)
+{
+    std::shared_ptr<IdItem> idItem;
+    RState state = FindResourceByHandle(handle, idItem);
+    if (state != SUCCESS) {
+        return state;
+    }
+    state = GetString(idItem, outValue);
+    if (state != SUCCESS && state != ERROR_CODE_RES_REF_TOO_MUCH) {
+        return GetHandleNotFoundState(handle);
+    }
+    return state;
+}
+
+RState ResourceManagerImpl::GetColorByHandle(const std::shared_ptr<ResourceHandle> &handle, uint32_t &outValue)
+{
+    std::shared_ptr<IdItem> idItem;
+    RState state = FindResourceByHandle(handle, idItem);
+    if (state != SUCCESS) {
+        return state;
+    }
+
+    // find in theme pack
+    if (GetThemeColor(idItem, outValue) == SUCCESS) {
+        return SUCCESS;
+    }
+
+    state = GetColor(idItem, outValue);
+    if (state != SUCCESS && state != ERROR_CODE_RES_REF_TOO_MUCH) {
+        return GetHandleNotFoundState(handle);
+    }
+    return state;
+}
+
+uint64_t ResourceManagerImpl::GetResourceGeneration()
+{
+    // both generations only increase, so the sum changes whenever either of them changes
+    return static_cast<uint64_t>(hapManager_->GetResourceGeneration()) + hapManager_->GetConfigGeneration();
+}
+
+uint64_t ResourceManagerImpl::GetConfigGeneration()
+{
+    return hapManager_->GetConfigGeneration();
+}
+
+uint32_t ResourceManagerImpl::GetLastConfigChanges()
+{
+    return hapManager_->GetLastConfigChanges();
+}
+
+RState ResourceManagerImpl::GetBatchItem(const std::shared_ptr<IdItem> idItem, const ResConfigImpl &resConfig,
+    BatchItem &item, std::string &arena)
+{
+    if (idItem == nullptr) {
+        RESMGR_HILOGE(RESMGR_TAG, "GetResourcesByIds error id = %{public}d", item.id);
+        return ERROR_CODE_RES_ID_NOT_FOUND;
+    }
+    RState state = NOT_FOUND;
+    switch (item.type) {
+        case ResType::STRING: {
+            std::string value;
+            state = GetString(idItem, value);
+            if (state == SUCCESS) {
+                item.stringOffset = arena.size();
+                item.stringLen = value.size();
+                arena.append(value).push_back('\0');
+            }
+            break;
+        }
+        case ResType::COLOR:
+            if (GetThemeColor(idItem, resConfig, item.colorValue) == SUCCESS) {
+                return SUCCESS;
+            }
+            state = GetColor(idItem, item.colorValue);
+            break;
+        case ResType::FLOAT: {
+            if (GetThemeFloat(idItem, resConfig, item.floatValue) == SUCCESS) {
+                return SUCCESS;
+            }
+            std::string unit;
+            state = GetFloat(idItem, item.floatValue, unit);
+            if (state == SUCCESS) {
+                return RecalculateFloat(unit, item.floatValue, resConfig);
+            }
+            break;
+        }
+        case ResType::INTEGER:
+            state = GetInteger(idItem, item.intValue);
+            break;
+        case ResType::BOOLEAN:
+            state = GetBoolean(idItem, item.boolValue);
+            break;
+        default:
+            RESMGR_HILOGE(RESMGR_TAG, "GetResourcesByIds unsupported type = %{public}d", item.type);
+            return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    if (state != SUCCESS && state != ERROR_CODE_RES_REF_TOO_MUCH) {
+        return ERROR_CODE_RES_NOT_FOUND_BY_ID;
+    }
+    return state;
+}
+
 RState ResourceManagerImpl::GetThemeMediaBase64(const std::shared_ptr<IdItem> idItem, std::string &outValue)
 {
     ResConfigImpl resConfig;
@@ -2125,6 +2475,21 @@ bool ResourceManagerImpl::IsOverride()
     return isOverrideResMgr_;
 }
 
+std::shared_ptr<ResourceManagerImpl> ResourceManagerImpl::CloneSharedResourceManager(const std::string &hapPath)
+{
+    auto impl = std::make_shared<ResourceManagerImpl>();
+    if (impl == nullptr || !impl->Init(this->GetHapManager())) {
+        RESMGR_HILOGE(RESMGR_TAG, "CloneSharedResourceManager failed bundleName = %{public}s, moduleName = %{public}s",
+            this->bundleInfo.first.c_str(), this->bundleInfo.second.c_str());
+        return nullptr;
+    }
+    impl->systemResourceManager_ = this->systemResourceManager_;
+    impl->bundleInfo = this->bundleInfo;
+    impl->userId = this->userId;
+    impl->sharedHapPath_ = hapPath;
+    return impl;
+}
+
 std::shared_ptr<ResourceManager> ResourceManagerImpl::GetOverrideResourceManager(
     std::shared_ptr<ResConfig> overrideResConfig)
 {
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "resource_prefetcher.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+PrefetchTask::PrefetchTask(size_t batchCount, size_t failedCount)
+    : pendingBatches_(batchCount), failedCount_(failedCount)
+{}
+
+RState PrefetchTask::Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return pendingBatches_ == 0 || isCancelled_.load(); });
+    if (isCancelled_.load()) {
+        return ERROR;
+    }
+    return failedCount_ == 0 ? SUCCESS : NOT_FOUND;
+}
+
+bool PrefetchTask::WaitFor(uint32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+        [this] { return pendingBatches_ == 0 || isCancelled_.load(); });
+}
+
+void PrefetchTask::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isCancelled_.store(true);
+    }
+    cv_.notify_all();
+}
+
+bool PrefetchTask::IsFinished()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pendingBatches_ == 0 || isCancelled_.load();
+}
+
+bool PrefetchTask::IsCancelled() const
+{
+    return isCancelled_.load();
+}
+
+void PrefetchTask::FinishBatch(size_t failedCount)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        failedCount_ += failedCount;
+        if (pendingBatches_ > 0) {
+            pendingBatches_--;
+        }
+    }
+    cv_.notify_all();
+}
+
+PrefetchWorkerPool::PrefetchWorkerPool()
+{
+    size_t hardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+    maxWorkers_ = std::max(static_cast<size_t>(1), std::min(hardwareThreads, MAX_WORKERS));
+}
+
+PrefetchWorkerPool& PrefetchWorkerPool::GetInstance()
+{
+    // leaked on purpose, joining the workers during the static destruction at exit may deadlock
+    static PrefetchWorkerPool *instance = new PrefetchWorkerPool();
+    return *instance;
+}
+
+void PrefetchWorkerPool::Submit(std::function<void()> work)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        works_.emplace_back(std::move(work));
+        if (idleWorkers_ < works_.size() && workers_.size() < maxWorkers_) {
+            workers_.emplace_back(&PrefetchWorkerPool::WorkLoop, this);
+        }
+    }
+    cv_.notify_one();
+}
+
+size_t PrefetchWorkerPool::GetMaxWorkers() const
+{
+    return maxWorkers_;
+}
+
+void PrefetchWorkerPool::WorkLoop()
+{
+    while (true) {
+        std::function<void()> work;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idleWorkers_++;
+            cv_.wait(lock, [this] { return !works_.empty(); });
+            idleWorkers_--;
+            work = std::move(works_.front());
+            works_.pop_front();
+        }
+        work();
+    }
+}
+
+std::shared_ptr<ResourceManager::PrefetchHandle> ResourcePrefetcher::Prefetch(
+    const std::shared_ptr<HapManager> &hapManager, std::vector<PrefetchItem> &items, size_t failedCount)
+{
+    if (hapManager == nullptr || (items.empty() && failedCount == 0)) {
+        return nullptr;
+    }
+    // read every hap from front to back, so the batches of one hap never seek backwards
+    std::stable_sort(items.begin(), items.end(), [](const PrefetchItem &left, const PrefetchItem &right) {
+        if (left.hapPath != right.hapPath) {
+            return left.hapPath < right.hapPath;
+        }
+        return left.offset < right.offset;
+    });
+    if (items.empty()) {
+        return std::make_shared<PrefetchTask>(0, failedCount);
+    }
+    size_t maxBatches = std::min(items.size(), PrefetchWorkerPool::GetInstance().GetMaxWorkers());
+    size_t batchSize = (items.size() + maxBatches - 1) / maxBatches;
+    size_t batchCount = (items.size() + batchSize - 1) / batchSize;
+    auto task = std::make_shared<PrefetchTask>(batchCount, failedCount);
+    for (size_t begin = 0; begin < items.size(); begin += batchSize) {
+        size_t end = std::min(begin + batchSize, items.size());
+        auto batch = std::make_shared<std::vector<PrefetchItem>>(items.begin() + begin, items.begin() + end);
+        PrefetchWorkerPool::GetInstance().Submit([hapManager, batch, task]() {
+            task->FinishBatch(ReadBatch(hapManager, *batch, task));
+        });
+    }
+    return task;
+}
+
+std::shared_ptr<ResourceManager::PrefetchHandle> ResourcePrefetcher::Preload(
+    const std::shared_ptr<HapManager> &hapManager, const std::vector<uint32_t> &ids, bool isOverride)
+{
+    if (hapManager == nullptr || ids.empty()) {
+        return nullptr;
+    }
+    size_t maxBatches = std::min(ids.size(), PrefetchWorkerPool::GetInstance().GetMaxWorkers());
+    size_t batchSize = (ids.size() + maxBatches - 1) / maxBatches;
+    size_t batchCount = (ids.size() + batchSize - 1) / batchSize;
+    auto task = std::make_shared<PrefetchTask>(batchCount, 0);
+    for (size_t begin = 0; begin < ids.size(); begin += batchSize) {
+        size_t end = std::min(begin + batchSize, ids.size());
+        auto batch = std::make_shared<std::vector<uint32_t>>(ids.begin() + begin, ids.begin() + end);
+        PrefetchWorkerPool::GetInstance().Submit([hapManager, batch, isOverride, task]() {
+            task->FinishBatch(PreloadBatch(hapManager, *batch, isOverride, task));
+        });
+    }
+    return task;
+}
+
+size_t ResourcePrefetcher::PreloadBatch(const std::shared_ptr<HapManager> &hapManager,
+    const std::vector<uint32_t> &batch, bool isOverride, const std::shared_ptr<PrefetchTask> &task)
+{
+    size_t failedCount = 0;
+    for (uint32_t id : batch) {
+        if (task->IsCancelled()) {
+            break;
+        }
+        // the preloaded ids are not accessed by the app, so they are not recorded as hot
+        auto qualifierDir = hapManager->FindQualifierValueById(id, isOverride,
+            ScreenDensity::SCREEN_DENSITY_NOT_SET, false);
+        std::shared_ptr<IdItem> idItem = qualifierDir == nullptr ? nullptr : qualifierDir->GetIdItem();
+        if (idItem == nullptr) {
+            RESMGR_HILOGD(RESMGR_TAG, "preload resource failed, id = %{public}u", id);
+            failedCount++;
+            continue;
+        }
+        if (idItem->resType_ != ResType::MEDIA) {
+            continue;
+        }
+        size_t len = 0;
+        std::shared_ptr<const uint8_t[]> data;
+        if (hapManager->GetMediaData(qualifierDir, len, data) != SUCCESS) {
+            failedCount++;
+        }
+    }
+    return failedCount;
+}
+
+size_t ResourcePrefetcher::ReadBatch(const std::shared_ptr<HapManager> &hapManager,
+    const std::vector<PrefetchItem> &batch, const std::shared_ptr<PrefetchTask> &task)
+{
+    size_t failedCount = 0;
+    for (const auto &item : batch) {
+        if (task->IsCancelled()) {
+            break;
+        }
+        RState state;
+        if (item.qualifierDir != nullptr) {
+            size_t len = 0;
+            std::shared_ptr<const uint8_t[]> data;
+            state = hapManager->GetMediaData(item.qualifierDir, len, data);
+        } else {
+            state = hapManager->PrefetchRawFile(item.rawFileName);
+        }
+        if (state != SUCCESS) {
+            RESMGR_HILOGD(RESMGR_TAG, "prefetch resource failed, state = %{public}d", state);
+            failedCount++;
+        }
+    }
+    return failedCount;
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "resource_table_cache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <mutex>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_set>
+
+#include "hilog_wrapper.h"
+#include "resource_prefetcher.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+const std::string ResourceTableCache::SYSTEM_CACHE_DIR = "/data/global/resource_table/";
+
+const std::string ResourceTableCache::APP_CACHE_DIR = "/data/storage/el2/base/cache/";
+
+namespace {
+constexpr char CACHE_TAG[] = { 'R', 'T', 'B', 'C' };
+constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+constexpr uint32_t CACHE_ALIGN = 4;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+constexpr uint32_t TYPE_HASH_FACTOR = 0x9e3779b1u;
+// resConfigId and the count of the params lead each key
+constexpr uint32_t KEY_HEAD_LEN = 2;
+constexpr uint32_t KEY_PARAM_LEN = 2;
+constexpr char CACHE_PREFIX[] = "resources_";
+constexpr char CACHE_SUFFIX[] = ".table";
+
+inline uint64_t AlignUp(uint64_t value)
+{
+    return (value + CACHE_ALIGN - 1) / CACHE_ALIGN * CACHE_ALIGN;
+}
+
+bool WriteCacheFile(const std::string &cachePath, const std::vector<uint8_t> &data)
+{
+    // write a temporary file first, the processes mapping the old cache keep reading it until they reopen
+    std::string tmpPath = cachePath + ".tmp." + std::to_string(getpid());
+    FILE *fp = fopen(tmpPath.c_str(), "wb");
+    if (fp == nullptr) {
+        RESMGR_HILOGD(RESMGR_TAG, "open resource table cache failed, errno = %{public}d", errno);
+        return false;
+    }
+    bool success = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    success = (fflush(fp) == 0) && success;
+    success = (fclose(fp) == 0) && success;
+    if (!success || rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        RESMGR_HILOGE(RESMGR_TAG, "write resource table cache failed, errno = %{public}d", errno);
+        remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// the caches being built or failed to build, a failed build is not retried until the process restarts
+std::mutex &GetBuildMutex()
+{
+    // leaked on purpose, the workers of the pool may still lock it during the static destruction at exit
+    static std::mutex *buildMutex = new std::mutex();
+    return *buildMutex;
+}
+
+std::unordered_set<std::string> &GetBlockedCachePaths()
+{
+    static std::unordered_set<std::string> *blockedCachePaths = new std::unordered_set<std::string>();
+    return *blockedCachePaths;
+}
+} // namespace
+
+uint32_t ResourceTableCache::Hash(const uint8_t *data, size_t len, uint32_t seed)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash ^ (seed * TYPE_HASH_FACTOR);
+}
+
+uint32_t ResourceTableCache::GetChecksum(const CacheHeader &header)
+{
+    CacheHeader checkedHeader = header;
+    checkedHeader.checksum = 0;
+    return Hash(reinterpret_cast<const uint8_t *>(&checkedHeader), sizeof(CacheHeader), 0);
+}
+
+bool ResourceTableCache::UpdateChecksum(std::vector<uint8_t> &data)
+{
+    if (data.size() < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header {};
+    std::copy_n(data.begin(), sizeof(CacheHeader), reinterpret_cast<uint8_t *>(&header));
+    header.checksum = GetChecksum(header);
+    std::copy_n(reinterpret_cast<const uint8_t *>(&header), sizeof(CacheHeader), data.begin());
+    return true;
+}
+
+std::string ResourceTableCache::GetCacheName(const std::string &cacheDir, const std::string &key)
+{
+    const int hashStrLen = 9;
+    char hashStr[hashStrLen] = {0};
+    uint32_t hash = Hash(reinterpret_cast<const uint8_t *>(key.c_str()), key.size(), 0);
+    if (std::snprintf(hashStr, sizeof(hashStr), "%08x", hash) < 0) {
+        return "";
+    }
+    return cacheDir + CACHE_PREFIX + hashStr + CACHE_SUFFIX;
+}
+
+std::string ResourceTableCache::GetCachePath(const std::string &cacheDir, const std::string &sourcePath)
+{
+    return GetCacheName(cacheDir, sourcePath);
+}
+
+std::string ResourceTableCache::GetSharedCachePath(const std::string &cacheDir, const std::string &sourcePath)
+{
+    // the sandbox reaches the system resource by another path, the bind mount keeps the device and inode
+    struct stat sourceStat {};
+    if (stat(sourcePath.c_str(), &sourceStat) != 0) {
+        return "";
+    }
+    return GetCacheName(cacheDir, std::to_string(static_cast<uint64_t>(sourceStat.st_dev)) + ":" +
+        std::to_string(static_cast<uint64_t>(sourceStat.st_ino)));
+}
+
+void ResourceTableCache::RemoveUnusedCaches(const std::string &cacheDir,
+    const std::unordered_set<std::string> &usedCachePaths)
+{
+    DIR *dir = opendir(cacheDir.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    const size_t prefixLen = strlen(CACHE_PREFIX);
+    const size_t suffixLen = strlen(CACHE_SUFFIX);
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name.size() <= prefixLen + suffixLen || name.compare(0, prefixLen, CACHE_PREFIX) != 0 ||
+            name.compare(name.size() - suffixLen, suffixLen, CACHE_SUFFIX) != 0) {
+            continue;
+        }
+        std::string cachePath = cacheDir + name;
+        if (usedCachePaths.find(cachePath) == usedCachePaths.end() && remove(cachePath.c_str()) == 0) {
+            RESMGR_HILOGI(RESMGR_TAG, "remove unused resource table cache %{public}s", name.c_str());
+        }
+    }
+    closedir(dir);
+}
+
+bool ResourceTableCache::Build(const std::string &sourcePath, const std::vector<Key> &keys,
+    const std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> &idMap, const std::string &cachePath)
+{
+    struct stat sourceStat {};
+    if (keys.empty() || idMap.empty() || stat(sourcePath.c_str(), &sourceStat) != 0) {
+        return false;
+    }
+    std::vector<uint32_t> flatKeys;
+    for (const Key &key : keys) {
+        flatKeys.push_back(key.resConfigId);
+        flatKeys.push_back(static_cast<uint32_t>(key.params.size()));
+        for (const auto &param : key.params) {
+            flatKeys.push_back(param.first);
+            flatKeys.push_back(param.second);
+        }
+    }
+
+    std::vector<std::shared_ptr<IdValuesV2>> values;
+    values.reserve(idMap.size());
+    for (const auto &iter : idMap) {
+        if (iter.second != nullptr) {
+            values.push_back(iter.second);
+        }
+    }
+    std::sort(values.begin(), values.end(), [](const auto &left, const auto &right) {
+        return left->GetId() < right->GetId();
+    });
+    uint32_t bucketCount = 1;
+    while (bucketCount < values.size()) {
+        bucketCount <<= 1;
+    }
+    std::vector<uint32_t> buckets(bucketCount, INVALID_INDEX);
+    std::vector<CacheItem> items(values.size());
+    std::string names;
+    for (uint32_t i = 0; i < values.size(); i++) {
+        const std::string name = values[i]->GetName();
+        uint32_t type = static_cast<uint32_t>(values[i]->GetResType());
+        uint32_t bucket = Hash(reinterpret_cast<const uint8_t *>(name.c_str()), name.size(), type) & (bucketCount - 1);
+        items[i] = { values[i]->GetId(), type, values[i]->GetOffset(), static_cast<uint32_t>(names.size()),
+            static_cast<uint32_t>(name.size()), buckets[bucket] };
+        buckets[bucket] = i;
+        names.append(name);
+    }
+
+    uint64_t keysOffset = AlignUp(sizeof(CacheHeader) + sourcePath.size());
+    uint64_t itemsOffset = keysOffset + flatKeys.size() * sizeof(uint32_t);
+    uint64_t bucketsOffset = itemsOffset + items.size() * sizeof(CacheItem);
+    uint64_t namesOffset = bucketsOffset + buckets.size() * sizeof(uint32_t);
+    uint64_t cacheLen = namesOffset + names.size();
+    if (cacheLen > UINT32_MAX) {
+        return false;
+    }
+    std::vector<uint8_t> data(cacheLen, 0);
+    std::copy(sourcePath.begin(), sourcePath.end(), data.begin() + sizeof(CacheHeader));
+    std::copy_n(reinterpret_cast<const uint8_t *>(flatKeys.data()), flatKeys.size() * sizeof(uint32_t),
+        data.begin() + keysOffset);
+    std::copy_n(reinterpret_cast<const uint8_t *>(items.data()), items.size() * sizeof(CacheItem),
+        data.begin() + itemsOffset);
+    std::copy_n(reinterpret_cast<const uint8_t *>(buckets.data()), buckets.size() * sizeof(uint32_t),
+        data.begin() + bucketsOffset);
+    std::copy(names.begin(), names.end(), data.begin() + namesOffset);
+
+    CacheHeader header {};
+    std::copy(std::begin(CACHE_TAG), std::end(CACHE_TAG), header.tag);
+    header.version = CACHE_VERSION;
+    header.sourceSize = static_cast<uint64_t>(sourceStat.st_size);
+    header.sourceMTime = static_cast<int64_t>(sourceStat.st_mtime);
+    header.sourceDev = static_cast<uint64_t>(sourceStat.st_dev);
+    header.sourceIno = static_cast<uint64_t>(sourceStat.st_ino);
+    header.sourcePathLen = static_cast<uint32_t>(sourcePath.size());
+    header.keyCount = static_cast<uint32_t>(keys.size());
+    header.keysOffset = static_cast<uint32_t>(keysOffset);
+    header.keysLen = static_cast<uint32_t>(flatKeys.size() * sizeof(uint32_t));
+    header.itemCount = static_cast<uint32_t>(items.size());
+    header.bucketCount = bucketCount;
+    header.itemsOffset = static_cast<uint32_t>(itemsOffset);
+    header.bucketsOffset = static_cast<uint32_t>(bucketsOffset);
+    header.namesOffset = static_cast<uint32_t>(namesOffset);
+    header.namesLen = static_cast<uint32_t>(names.size());
+    header.checksum = GetChecksum(header);
+    std::copy_n(reinterpret_cast<const uint8_t *>(&header), sizeof(CacheHeader), data.begin());
+    return WriteCacheFile(cachePath, data);
+}
+
+bool ResourceTableCache::BuildAsync(const std::string &sourcePath, std::vector<Key> &&keys,
+    const std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> &idMap, const std::string &cachePath)
+{
+    {
+        std::lock_guard<std::mutex> lock(GetBuildMutex());
+        if (!GetBlockedCachePaths().insert(cachePath).second) {
+            return false;
+        }
+    }
+    std::string cacheDir = cachePath.substr(0, cachePath.rfind('/') + 1);
+    if (access(cacheDir.c_str(), W_OK) != 0) {
+        // the path stays blocked, the directory is not checked again by the next load
+        RESMGR_HILOGD(RESMGR_TAG, "resource table cache dir is not writable, errno = %{public}d", errno);
+        return false;
+    }
+    PrefetchWorkerPool::GetInstance().Submit([sourcePath, keys = std::move(keys), idMap, cachePath]() {
+        if (!Build(sourcePath, keys, idMap, cachePath)) {
+            return;
+        }
+        // the next load maps the cache instead of parsing the resource index again
+        RESMGR_HILOGI(RESMGR_TAG, "resource table cache built, count = %{public}zu", idMap.size());
+        std::lock_guard<std::mutex> lock(GetBuildMutex());
+        GetBlockedCachePaths().erase(cachePath);
+    });
+    return true;
+}
+
+std::shared_ptr<ResourceTableCache> ResourceTableCache::Open(const std::string &sourcePath,
+    const std::string &cachePath)
+{
+    struct stat cacheStat {};
+    if (cachePath.empty() || stat(cachePath.c_str(), &cacheStat) != 0) {
+        return nullptr;
+    }
+    std::shared_ptr<ResourceTableCache> cache = Load(MmapFile::MapReadOnly(cachePath));
+    if (cache == nullptr) {
+        RESMGR_HILOGW(RESMGR_TAG, "resource table cache is damaged");
+        return nullptr;
+    }
+    // the file is compared instead of the path, the sandbox and the builder reach the same file by different paths
+    struct stat sourceStat {};
+    if (stat(sourcePath.c_str(), &sourceStat) != 0 ||
+        cache->sourceDev_ != static_cast<uint64_t>(sourceStat.st_dev) ||
+        cache->sourceIno_ != static_cast<uint64_t>(sourceStat.st_ino) ||
+        cache->sourceSize_ != static_cast<uint64_t>(sourceStat.st_size) ||
+        cache->sourceMTime_ != static_cast<int64_t>(sourceStat.st_mtime)) {
+        RESMGR_HILOGI(RESMGR_TAG, "resource table cache is out of date, built from %{public}s",
+            cache->sourcePath_.c_str());
+        return nullptr;
+    }
+    return cache;
+}
+
+std::shared_ptr<ResourceTableCache> ResourceTableCache::Load(const std::shared_ptr<MmapFile> &mapFile)
+{
+    if (mapFile == nullptr || mapFile->mmap_ == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<ResourceTableCache> cache = std::make_shared<ResourceTableCache>();
+    if (!cache->Init(mapFile)) {
+        return nullptr;
+    }
+    return cache;
+}
+
+bool ResourceTableCache::Init(const std::shared_ptr<MmapFile> &mapFile)
+{
+    uint64_t mapLen = mapFile->mmapLen_;
+    if (mapLen < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header {};
+    std::copy_n(mapFile->mmap_, sizeof(CacheHeader), reinterpret_cast<uint8_t *>(&header));
+    if (!std::equal(std::begin(CACHE_TAG), std::end(CACHE_TAG), header.tag) || header.version != CACHE_VERSION) {
+        return false;
+    }
+    if (sizeof(CacheHeader) + static_cast<uint64_t>(header.sourcePathLen) > header.keysOffset ||
+        header.keysOffset % CACHE_ALIGN != 0 || header.keysLen % sizeof(uint32_t) != 0 ||
+        header.keysOffset + static_cast<uint64_t>(header.keysLen) > header.itemsOffset ||
+        header.itemsOffset % CACHE_ALIGN != 0 ||
+        header.itemsOffset + static_cast<uint64_t>(header.itemCount) * sizeof(CacheItem) > header.bucketsOffset ||
+        header.bucketsOffset % CACHE_ALIGN != 0 ||
+        header.bucketsOffset + static_cast<uint64_t>(header.bucketCount) * sizeof(uint32_t) > header.namesOffset ||
+        header.namesOffset + static_cast<uint64_t>(header.namesLen) > mapLen) {
+        return false;
+    }
+    if (header.bucketCount == 0 || (header.bucketCount & (header.bucketCount - 1)) != 0) {
+        return false;
+    }
+    if (header.checksum != GetChecksum(header)) {
+        return false;
+    }
+    mapFile_ = mapFile;
+    sourcePath_.assign(reinterpret_cast<const char *>(mapFile->mmap_) + sizeof(CacheHeader), header.sourcePathLen);
+    sourceSize_ = header.sourceSize;
+    sourceMTime_ = header.sourceMTime;
+    sourceDev_ = header.sourceDev;
+    sourceIno_ = header.sourceIno;
+    keys_ = reinterpret_cast<const uint32_t *>(mapFile->mmap_ + header.keysOffset);
+    keyCount_ = header.keyCount;
+    keysLen_ = header.keysLen / sizeof(uint32_t);
+    items_ = reinterpret_cast<const CacheItem *>(mapFile->mmap_ + header.itemsOffset);
+    buckets_ = reinterpret_cast<const uint32_t *>(mapFile->mmap_ + header.bucketsOffset);
+    names_ = reinterpret_cast<const char *>(mapFile->mmap_ + header.namesOffset);
+    itemCount_ = header.itemCount;
+    bucketCount_ = header.bucketCount;
+    namesLen_ = header.namesLen;
+    return true;
+}
+
+bool ResourceTableCache::GetKeys(std::vector<Key> &keys) const
+{
+    keys.reserve(keyCount_);
+    uint32_t pos = 0;
+    for (uint32_t i = 0; i < keyCount_; i++) {
+        if (keysLen_ - pos < KEY_HEAD_LEN) {
+            return false;
+        }
+        Key key;
+        key.resConfigId = keys_[pos];
+        uint32_t paramCount = keys_[pos + 1];
+        pos += KEY_HEAD_LEN;
+        if (paramCount > KeyType::KEY_TYPE_MAX || (keysLen_ - pos) / KEY_PARAM_LEN < paramCount) {
+            return false;
+        }
+        for (uint32_t j = 0; j < paramCount; j++) {
+            if (keys_[pos] >= KeyType::KEY_TYPE_MAX) {
+                return false;
+            }
+            key.params.emplace_back(keys_[pos], keys_[pos + 1]);
+            pos += KEY_PARAM_LEN;
+        }
+        keys.push_back(std::move(key));
+    }
+    return pos == keysLen_;
+}
+
+bool ResourceTableCache::ToItem(const CacheItem &cacheItem, Item &item) const
+{
+    if (static_cast<uint64_t>(cacheItem.nameOffset) + cacheItem.nameLen > namesLen_ ||
+        cacheItem.type >= ResType::MAX_RES_TYPE) {
+        return false;
+    }
+    item.id = cacheItem.id;
+    item.type = cacheItem.type;
+    item.offset = cacheItem.offset;
+    item.name.assign(names_ + cacheItem.nameOffset, cacheItem.nameLen);
+    return true;
+}
+
+bool ResourceTableCache::FindById(uint32_t id, Item &item) const
+{
+    const CacheItem *end = items_ + itemCount_;
+    const CacheItem *iter = std::lower_bound(items_, end, id, [](const CacheItem &cacheItem, uint32_t value) {
+        return cacheItem.id < value;
+    });
+    if (iter == end || iter->id != id) {
+        return false;
+    }
+    return ToItem(*iter, item);
+}
+
+bool ResourceTableCache::FindByName(const std::string &name, uint32_t type, Item &item) const
+{
+    uint32_t hash = Hash(reinterpret_cast<const uint8_t *>(name.c_str()), name.size(), type);
+    uint32_t index = buckets_[hash & (bucketCount_ - 1)];
+    // the chain never holds more than all items, a longer one means the cache is damaged
+    for (uint32_t steps = 0; index < itemCount_ && steps < itemCount_; steps++) {
+        const CacheItem &cacheItem = items_[index];
+        if (cacheItem.type == type && cacheItem.nameLen == name.size() &&
+            static_cast<uint64_t>(cacheItem.nameOffset) + cacheItem.nameLen <= namesLen_ &&
+            name.compare(0, std::string::npos, names_ + cacheItem.nameOffset, cacheItem.nameLen) == 0) {
+            return ToItem(cacheItem, item);
+        }
+        index = cacheItem.next;
+    }
+    return false;
+}
+
+bool ResourceTableCache::GetItem(uint32_t index, Item &item) const
+{
+    if (index >= itemCount_) {
+        return false;
+    }
+    return ToItem(items_[index], item);
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -15,8 +15,10 @@
 
 #include "system_resource_manager.h"
 
+#include "hap_parser_v2.h"
 #include "hilog_wrapper.h"
 #include "resource_manager.h"
+#include "resource_table_cache.h"
 #include "utils/utils.h"
 
 namespace OHOS {
@@ -146,6 +148,34 @@ bool SystemResourceManager::LoadSystemResource(ResourceManagerImpl *impl, bool i
     return false;
 }
 
+bool SystemResourceManager::BuildSystemResourceTableCache()
+{
+    // every hap LoadSystemResource may resolve, the caches are keyed on the files so a bind mount of a hap in the
+    // sandbox maps the same cache. The sandbox system resource of the system abilities is the compressed hap
+    const std::vector<std::string> sourcePaths = {
+        SYSTEM_RESOURCE_NO_SAND_BOX_PKG_PATH,
+        SYSTEM_RESOURCE_NO_SAND_BOX_HAP_PATH,
+        SYSTEM_RESOURCE_EXT_NO_SAND_BOX_HAP_PATH,
+        SYSTEM_RESOURCE_PATH_COMPRESSED,
+    };
+    bool result = true;
+    std::unordered_set<std::string> cachePaths;
+    for (const std::string &sourcePath : sourcePaths) {
+        std::string cachePath =
+            ResourceTableCache::GetSharedCachePath(ResourceTableCache::SYSTEM_CACHE_DIR, sourcePath);
+        if (cachePath.empty() || !cachePaths.insert(cachePath).second) {
+            continue;
+        }
+        if (!HapParserV2::PrepareTableCache(sourcePath, cachePath)) {
+            RESMGR_HILOGE(RESMGR_TAG, "build system resource table cache failed, %{public}s", sourcePath.c_str());
+            result = false;
+        }
+    }
+    // the caches of the resources replaced by an update are never opened again
+    ResourceTableCache::RemoveUnusedCaches(ResourceTableCache::SYSTEM_CACHE_DIR, cachePaths);
+    return result;
+}
+
 void SystemResourceManager::ReleaseSystemResourceManager()
 {
     std::lock_guard<std::mutex> lock(mutex_);
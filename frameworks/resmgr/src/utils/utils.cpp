@@ -246,7 +246,7 @@ uint16_t Utils::EncodeRegionByResLocale(const ResLocale *locale)
     if (locale == nullptr) {
         return NULL_REGION;
     }
-    return Utils::EncodeRegion(locale->GetRegion());
+    return locale->GetEncodedRegion();
 }
 
 uint16_t Utils::EncodeLanguageByResLocale(const ResLocale *locale)
@@ -254,7 +254,7 @@ uint16_t Utils::EncodeLanguageByResLocale(const ResLocale *locale)
     if (locale == nullptr) {
         return NULL_LANGUAGE;
     }
-    return Utils::EncodeLanguage(locale->GetLanguage());
+    return locale->GetEncodedLanguage();
 }
 
 uint32_t Utils::EncodeScriptByResLocale(const ResLocale *locale)
@@ -262,7 +262,7 @@ uint32_t Utils::EncodeScriptByResLocale(const ResLocale *locale)
     if (locale == nullptr) {
         return NULL_SCRIPT;
     }
-    return Utils::EncodeScript(locale->GetScript());
+    return locale->GetEncodedScript();
 }
 
 uint16_t Utils::EncodeRegion(const char *region)
@@ -15,7 +15,10 @@
 
 #include "hap_manager_test.h"
 
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "test_common.h"
 #include "utils/string_utils.h"
@@ -23,6 +26,7 @@
 #define private public
 
 #include "hap_manager.h"
+#include "hap_resource_manager.h"
 
 using namespace OHOS::Global::Resource;
 using namespace testing::ext;
@@ -879,4 +883,165 @@ HWTEST_F(HapManagerTest, HapManagerGetLocalesTest001, TestSize.Level1)
     hapManager->GetLocales(outValue, false);
     EXPECT_TRUE(outValue.size() == 0);
 }
-}
\ No newline at end of file
+
+/*
+ * @tc.name: HapManagerAddResourceConcurrentTest001
+ * @tc.desc: Test AddResource function, the same hap added by two threads is published once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerAddResourceConcurrentTest001, TestSize.Level1)
+{
+    std::shared_ptr<HapManager> hapManager = std::make_shared<HapManager>(std::make_shared<ResConfigImpl>());
+    ASSERT_TRUE(hapManager != nullptr);
+    std::string path = FormatFullPath(g_resFilePath);
+    uint32_t generation = hapManager->GetResourceGeneration();
+    bool ret1 = false;
+    bool ret2 = false;
+    std::thread t1([&hapManager, &path, &ret1] { ret1 = hapManager->AddResource(path.c_str(), SELECT_ALL); });
+    std::thread t2([&hapManager, &path, &ret2] { ret2 = hapManager->AddResource(path.c_str(), SELECT_ALL); });
+    t1.join();
+    t2.join();
+    EXPECT_TRUE(ret1 != ret2);
+    EXPECT_EQ(hapManager->hapResources_.size(), 1);
+    EXPECT_EQ(hapManager->GetResourceGeneration(), generation + 1);
+}
+
+/*
+ * @tc.name: HapManagerUpdateResConfigTest001
+ * @tc.desc: Test UpdateResConfig function, a locale switch parses only the keys of the new locale once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerUpdateResConfigTest001, TestSize.Level1)
+{
+    std::unique_ptr<ResConfig> rc(CreateResConfig());
+    ASSERT_TRUE(rc != nullptr);
+    rc->SetLocaleInfo("en", nullptr, "US");
+    std::shared_ptr<HapManager> hapManager = std::make_shared<HapManager>(std::make_shared<ResConfigImpl>());
+    hapManager->UpdateResConfig(*rc);
+    std::string path = FormatFullPath(g_resFilePath);
+    ASSERT_TRUE(hapManager->AddResource(path.c_str(), SELECT_ALL));
+
+    uint32_t id = 16777238; // 16777238 means string_ref
+    rc->SetLocaleInfo("zh", nullptr, "CN");
+    EXPECT_EQ(hapManager->UpdateResConfig(*rc), SUCCESS);
+    auto idValues = hapManager->GetResourceList(id);
+    ASSERT_EQ(idValues.size(), 1);
+    EXPECT_EQ(idValues[0]->GetLimitPathsConst().size(), 2);
+
+    // switching back to a loaded locale adds nothing
+    rc->SetLocaleInfo("en", nullptr, "US");
+    EXPECT_EQ(hapManager->UpdateResConfig(*rc), SUCCESS);
+    rc->SetLocaleInfo("zh", nullptr, "CN");
+    EXPECT_EQ(hapManager->UpdateResConfig(*rc), SUCCESS);
+    idValues = hapManager->GetResourceList(id);
+    ASSERT_EQ(idValues.size(), 1);
+    EXPECT_EQ(idValues[0]->GetLimitPathsConst().size(), 2);
+}
+
+/*
+ * @tc.name: HapManagerUpdateResConfigTest002
+ * @tc.desc: Test AddResource function, only the keys skipped because of their locale are kept pending.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerUpdateResConfigTest002, TestSize.Level1)
+{
+    std::unique_ptr<ResConfig> rc(CreateResConfig());
+    ASSERT_TRUE(rc != nullptr);
+    rc->SetLocaleInfo("en", nullptr, "US");
+    std::shared_ptr<ResConfigImpl> defaultConfig = std::make_shared<ResConfigImpl>();
+    std::shared_ptr<HapManager> hapManager = std::make_shared<HapManager>(defaultConfig);
+    hapManager->UpdateResConfig(*rc);
+    std::string path = FormatFullPath(g_resFilePath);
+    ASSERT_TRUE(hapManager->AddResource(path.c_str(), SELECT_STRING));
+    ASSERT_EQ(hapManager->hapResources_.size(), 1);
+    auto hapResource = std::static_pointer_cast<HapResourceV1>(hapManager->hapResources_[0]);
+    ASSERT_FALSE(hapResource->pendingKeys_.empty());
+    for (auto &key : hapResource->pendingKeys_) {
+        ASSERT_TRUE(key->resConfig_->GetResLocale() != nullptr);
+        EXPECT_FALSE(defaultConfig->MatchLocal(*key->resConfig_));
+        EXPECT_TRUE(defaultConfig->MatchExceptLocale(key->resConfig_, false));
+    }
+
+    rc->SetLocaleInfo("zh", nullptr, "CN");
+    EXPECT_EQ(hapManager->UpdateResConfig(*rc), SUCCESS);
+    for (auto &key : hapResource->pendingKeys_) {
+        EXPECT_FALSE(defaultConfig->MatchLocal(*key->resConfig_));
+    }
+}
+
+/*
+ * @tc.name: HapManagerAddResourceConcurrentTest002
+ * @tc.desc: Test AddResource function, the loaded resources are read while another hap is loading.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerAddResourceConcurrentTest002, TestSize.Level1)
+{
+    std::shared_ptr<HapManager> hapManager = std::make_shared<HapManager>(std::make_shared<ResConfigImpl>());
+    ASSERT_TRUE(hapManager->AddResource(FormatFullPath(g_resFilePath).c_str(), SELECT_ALL));
+    int id = 16777217;
+
+    // hold the hap cache so the load stays in HapResourceManager::Load until it is released
+    std::unique_lock<std::shared_mutex> loadLock(HapResourceManager::GetInstance().mutexRw_);
+    std::atomic<bool> isAdded { false };
+    std::string path = FormatFullPath(g_hapPath);
+    std::thread loader([&hapManager, &path, &isAdded] {
+        hapManager->AddResource(path.c_str(), SELECT_ALL);
+        isAdded = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // 100ms for the loader to enter the load
+
+    // the hap manager is not locked by the pending load, the readers and the config update go on
+    EXPECT_FALSE(isAdded.load());
+    EXPECT_TRUE(hapManager->mutex_.try_lock());
+    hapManager->mutex_.unlock();
+    for (int i = 0; i < 100; i++) { // read 100 times while the load is pending
+        EXPECT_FALSE(hapManager->GetResourceList(id).empty());
+    }
+    std::shared_ptr<ResConfigImpl> rc = std::make_shared<ResConfigImpl>();
+    rc->SetLocaleInfo("zh", nullptr, "CN");
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rc));
+    EXPECT_FALSE(isAdded.load());
+
+    loadLock.unlock();
+    loader.join();
+    EXPECT_TRUE(isAdded.load());
+    EXPECT_EQ(hapManager->hapResources_.size(), 2);
+    EXPECT_FALSE(hapManager->GetResourceList(id).empty());
+}
+
+/*
+ * @tc.name: HapManagerUpdateResConfigTest003
+ * @tc.desc: Test PrepareLocaleUpdate function, the index is read before the update which only parses from it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerUpdateResConfigTest003, TestSize.Level1)
+{
+    std::unique_ptr<ResConfig> rc(CreateResConfig());
+    ASSERT_TRUE(rc != nullptr);
+    rc->SetLocaleInfo("en", nullptr, "US");
+    std::shared_ptr<HapManager> hapManager = std::make_shared<HapManager>(std::make_shared<ResConfigImpl>());
+    hapManager->UpdateResConfig(*rc);
+    std::string path = FormatFullPath(g_resFilePath);
+    ASSERT_TRUE(hapManager->AddResource(path.c_str(), SELECT_ALL));
+    auto hapResource = std::static_pointer_cast<HapResourceV1>(hapManager->hapResources_[0]);
+    size_t pendingCount = hapResource->pendingKeys_.size();
+    ASSERT_GT(pendingCount, 0);
+
+    // the loaded locale needs no index
+    hapManager->PrepareLocaleUpdate(false, *rc);
+    EXPECT_TRUE(hapResource->preparedIndex_ == nullptr);
+
+    rc->SetLocaleInfo("zh", nullptr, "CN");
+    hapManager->PrepareLocaleUpdate(false, *rc);
+    ASSERT_TRUE(hapResource->preparedIndex_ != nullptr);
+    EXPECT_GT(hapResource->preparedIndexLen_, 0);
+
+    EXPECT_EQ(hapManager->UpdateResConfig(*rc), SUCCESS);
+    EXPECT_TRUE(hapResource->preparedIndex_ == nullptr);
+    EXPECT_LT(hapResource->pendingKeys_.size(), pendingCount);
+    uint32_t id = 16777238; // 16777238 means string_ref
+    auto idValues = hapManager->GetResourceList(id);
+    ASSERT_EQ(idValues.size(), 1);
+    EXPECT_EQ(idValues[0]->GetLimitPathsConst().size(), 2);
+}
+}
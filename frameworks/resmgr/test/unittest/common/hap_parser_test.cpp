@@ -24,6 +24,7 @@
 #include "hap_parser.h"
 #include "hap_parser_v1.h"
 #include "hap_parser_v2.h"
+#include "res_config_pool.h"
 
 using namespace OHOS::Global::Resource;
 using namespace testing::ext;
@@ -556,4 +557,40 @@ HWTEST_F(HapParserTest, BuildResConfig002, TestSize.Level1)
     std::shared_ptr<ResConfigImpl> resConfig = HapParser::BuildResConfig(&configKey);
     EXPECT_TRUE(resConfig != nullptr);
 }
+
+/*
+ * @tc.name: CreateResConfigFromKeyParamsTest001
+ * @tc.desc: Test CreateResConfigFromKeyParams shares the config of equal KeyParams
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapParserTest, CreateResConfigFromKeyParamsTest001, TestSize.Level1)
+{
+    auto createKeyParams = [](uint32_t colorMode) {
+        std::vector<std::shared_ptr<KeyParam>> keyParams;
+        auto kp = std::make_shared<KeyParam>();
+        kp->type_ = MCC;
+        kp->value_ = 999;
+        kp->InitStr();
+        keyParams.push_back(kp);
+        auto kp1 = std::make_shared<KeyParam>();
+        kp1->type_ = COLORMODE;
+        kp1->value_ = colorMode;
+        kp1->InitStr();
+        keyParams.push_back(kp1);
+        return keyParams;
+    };
+    auto config = HapParser::CreateResConfigFromKeyParams(createKeyParams(DARK));
+    ASSERT_TRUE(config != nullptr);
+    EXPECT_EQ(config, HapParser::CreateResConfigFromKeyParams(createKeyParams(DARK)));
+    auto lightConfig = HapParser::CreateResConfigFromKeyParams(createKeyParams(LIGHT));
+    ASSERT_TRUE(lightConfig != nullptr);
+    EXPECT_NE(config, lightConfig);
+    EXPECT_EQ(LIGHT, lightConfig->GetColorMode());
+
+    // the config is released once no one refers to it
+    std::string poolKey = HapParser::BuildResConfigPoolKey(createKeyParams(DARK));
+    EXPECT_EQ(config, ResConfigPool::GetInstance().Get(poolKey));
+    config = nullptr;
+    EXPECT_TRUE(ResConfigPool::GetInstance().Get(poolKey) == nullptr);
+}
 }
@@ -15,8 +15,11 @@
 
 #include "hap_resource_test.h"
 
+#include <chrono>
 #include <climits>
 #include <gtest/gtest.h>
+#include <thread>
+#include <unistd.h>
 
 #include "hap_parser.h"
 #include "hap_parser_v1.h"
@@ -27,6 +30,7 @@
 #include "utils/errors.h"
 #include "utils/string_utils.h"
 #include "hap_resource_manager.h"
+#include "resource_table_cache.h"
 
 #define private public
 
@@ -522,4 +526,177 @@ HWTEST_F(HapResourceTest, HapResourceGetLocaleTest002, TestSize.Level1)
     pResource->GetLocales(locales, false);
     EXPECT_EQ(locales.size(), 4);
 }
+
+/*
+ * @tc.name: HapResourceGetResIdByNameTest001
+ * @tc.desc: Test GetResIdByName function, the id matches the one found by GetIdValuesByName.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, HapResourceGetResIdByNameTest001, TestSize.Level1)
+{
+    auto rc = std::make_shared<ResConfigImpl>();
+    rc->SetLocaleInfo("en", nullptr, "US");
+    for (const std::string &resPath : { FormatFullPath(g_resFilePath), FormatFullPath(g_newResFilePath) }) {
+        auto pResource = HapResourceManager::GetInstance().Load(resPath.c_str(), rc);
+        ASSERT_TRUE(pResource != nullptr);
+        auto idValues = pResource->GetIdValuesByName("app_name", ResType::STRING);
+        ASSERT_TRUE(idValues != nullptr);
+        ASSERT_FALSE(idValues->GetLimitPathsConst().empty());
+        uint32_t id = pResource->GetResIdByName("app_name", ResType::STRING);
+        EXPECT_EQ(id, idValues->GetLimitPathsConst()[0]->GetIdItem()->id_);
+        EXPECT_EQ(pResource->GetResIdByName("app_name", ResType::MEDIA), 0);
+        EXPECT_EQ(pResource->GetResIdByName("not_exist_name", ResType::STRING), 0);
+    }
+}
+
+/*
+ * @tc.name: ResourceTableCacheTest001
+ * @tc.desc: Test Build & Open & FindById & FindByName & GetKeys function of the resource table cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, ResourceTableCacheTest001, TestSize.Level1)
+{
+    std::string sourcePath = FormatFullPath(g_newResFilePath);
+    std::string cachePath = sourcePath + ".table";
+    std::vector<ResourceTableCache::Key> keys;
+    keys.push_back({ 0, {} });
+    keys.push_back({ 1, { { KeyType::LANGUAGES, 0x7a68 }, { KeyType::COLORMODE, ColorMode::DARK } } });
+    std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> idMap;
+    idMap[0x01000001] = std::make_shared<IdValuesV2>(ResType::STRING, 0x01000001, 100, "app_name");
+    idMap[0x01000002] = std::make_shared<IdValuesV2>(ResType::COLOR, 0x01000002, 200, "app_name");
+    idMap[0x01000000] = std::make_shared<IdValuesV2>(ResType::STRING, 0x01000000, 300, "title");
+    ASSERT_TRUE(ResourceTableCache::Build(sourcePath, keys, idMap, cachePath));
+
+    auto cache = ResourceTableCache::Open(sourcePath, cachePath);
+    ASSERT_TRUE(cache != nullptr);
+    EXPECT_EQ(cache->GetItemCount(), 3);
+    ResourceTableCache::Item item;
+    ASSERT_TRUE(cache->FindById(0x01000002, item));
+    EXPECT_EQ(item.type, static_cast<uint32_t>(ResType::COLOR));
+    EXPECT_EQ(item.offset, 200);
+    EXPECT_EQ(item.name, "app_name");
+    ASSERT_TRUE(cache->FindByName("app_name", ResType::STRING, item));
+    EXPECT_EQ(item.id, 0x01000001);
+    EXPECT_FALSE(cache->FindById(0x01000003, item));
+    EXPECT_FALSE(cache->FindByName("title", ResType::COLOR, item));
+    std::vector<ResourceTableCache::Key> cacheKeys;
+    ASSERT_TRUE(cache->GetKeys(cacheKeys));
+    ASSERT_EQ(cacheKeys.size(), 2);
+    EXPECT_TRUE(cacheKeys[0].params.empty());
+    EXPECT_EQ(cacheKeys[1].resConfigId, 1);
+    ASSERT_EQ(cacheKeys[1].params.size(), 2);
+    EXPECT_EQ(cacheKeys[1].params[1].first, static_cast<uint32_t>(KeyType::COLORMODE));
+    EXPECT_EQ(cacheKeys[1].params[1].second, static_cast<uint32_t>(ColorMode::DARK));
+
+    // the cache is rejected for another resource file
+    EXPECT_TRUE(ResourceTableCache::Open(FormatFullPath(g_resFilePath), cachePath) == nullptr);
+
+    // the cache is rejected once its header is damaged
+    cache = nullptr;
+    const long keyCountOffset = 28;
+    FILE *fp = fopen(cachePath.c_str(), "r+b");
+    ASSERT_TRUE(fp != nullptr);
+    fseek(fp, keyCountOffset, SEEK_SET);
+    int value = fgetc(fp);
+    fseek(fp, keyCountOffset, SEEK_SET);
+    fputc(value ^ 0xff, fp);
+    fclose(fp);
+    EXPECT_TRUE(ResourceTableCache::Open(sourcePath, cachePath) == nullptr);
+    remove(cachePath.c_str());
+}
+
+/*
+ * @tc.name: ResourceTableCacheTest002
+ * @tc.desc: Test BuildAsync function, the cache is built on the worker pool and a blocked build is skipped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, ResourceTableCacheTest002, TestSize.Level1)
+{
+    std::string sourcePath = FormatFullPath(g_newResFilePath);
+    std::string cachePath = sourcePath + ".async.table";
+    std::unordered_map<uint32_t, std::shared_ptr<IdValuesV2>> idMap;
+    idMap[0x01000001] = std::make_shared<IdValuesV2>(ResType::STRING, 0x01000001, 100, "app_name");
+    std::vector<ResourceTableCache::Key> keys;
+    keys.push_back({ 0, {} });
+    ASSERT_TRUE(ResourceTableCache::BuildAsync(sourcePath, std::move(keys), idMap, cachePath));
+    const int maxWaitCount = 100;
+    const int waitMs = 10;
+    std::shared_ptr<ResourceTableCache> cache = nullptr;
+    for (int i = 0; i < maxWaitCount && cache == nullptr; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(waitMs));
+        cache = ResourceTableCache::Open(sourcePath, cachePath);
+    }
+    ASSERT_TRUE(cache != nullptr);
+    EXPECT_EQ(cache->GetItemCount(), 1);
+    remove(cachePath.c_str());
+
+    // a build failed once is not retried, neither is a build to a directory which is not writable
+    std::vector<ResourceTableCache::Key> emptyKeys;
+    std::string failedPath = sourcePath + ".failed.table";
+    EXPECT_TRUE(ResourceTableCache::BuildAsync(sourcePath, std::move(emptyKeys), idMap, failedPath));
+    keys.clear();
+    keys.push_back({ 0, {} });
+    EXPECT_FALSE(ResourceTableCache::BuildAsync(sourcePath, std::move(keys), idMap, failedPath));
+    keys.clear();
+    keys.push_back({ 0, {} });
+    EXPECT_FALSE(ResourceTableCache::BuildAsync(sourcePath, std::move(keys), idMap,
+        sourcePath + ".not_exist/resources.table"));
+}
+
+/*
+ * @tc.name: ResourceTableCacheTest003
+ * @tc.desc: Test that an app only opens the system resource table cache and never builds it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, ResourceTableCacheTest003, TestSize.Level1)
+{
+    std::string sourcePath = FormatFullPath(g_newResFilePath);
+    std::string cachePath = sourcePath + ".system.table";
+    remove(cachePath.c_str());
+    HapParserV2 hapParser;
+    hapParser.SetTableCachePath(cachePath, HapParserV2::OPEN_ONLY);
+    ASSERT_TRUE(hapParser.Init(sourcePath.c_str()));
+    EXPECT_TRUE(ResourceTableCache::Open(sourcePath, cachePath) == nullptr);
+
+    // the privileged builder writes the cache, the next app load maps it
+    ASSERT_TRUE(HapParserV2::PrepareTableCache(sourcePath, cachePath));
+    EXPECT_TRUE(ResourceTableCache::Open(sourcePath, cachePath) != nullptr);
+    HapParserV2 cachedParser;
+    cachedParser.SetTableCachePath(cachePath, HapParserV2::OPEN_ONLY);
+    ASSERT_TRUE(cachedParser.Init(sourcePath.c_str()));
+    EXPECT_TRUE(cachedParser.GetHapResource(sourcePath.c_str(), true, false) != nullptr);
+    remove(cachePath.c_str());
+}
+
+/*
+ * @tc.name: ResourceTableCacheTest004
+ * @tc.desc: Test GetSharedCachePath & RemoveUnusedCaches, another path of the same file maps the same cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, ResourceTableCacheTest004, TestSize.Level1)
+{
+    std::string sourcePath = FormatFullPath(g_newResFilePath);
+    std::string cacheDir = sourcePath.substr(0, sourcePath.rfind('/') + 1);
+    std::string linkPath = sourcePath + ".link";
+    remove(linkPath.c_str());
+    ASSERT_EQ(symlink(sourcePath.c_str(), linkPath.c_str()), 0);
+    std::string cachePath = ResourceTableCache::GetSharedCachePath(cacheDir, sourcePath);
+    ASSERT_FALSE(cachePath.empty());
+    EXPECT_EQ(cachePath, ResourceTableCache::GetSharedCachePath(cacheDir, linkPath));
+    EXPECT_TRUE(ResourceTableCache::GetSharedCachePath(cacheDir, sourcePath + ".not_exist").empty());
+
+    // the cache built from one path is opened by the other one
+    ASSERT_TRUE(HapParserV2::PrepareTableCache(linkPath, cachePath));
+    EXPECT_TRUE(ResourceTableCache::Open(sourcePath, cachePath) != nullptr);
+    EXPECT_TRUE(ResourceTableCache::Open(FormatFullPath(g_resFilePath), cachePath) == nullptr);
+
+    // only the caches in use are kept
+    std::string unusedPath = ResourceTableCache::GetCachePath(cacheDir, linkPath);
+    ASSERT_TRUE(HapParserV2::PrepareTableCache(linkPath, unusedPath));
+    ResourceTableCache::RemoveUnusedCaches(cacheDir, { cachePath });
+    EXPECT_EQ(access(cachePath.c_str(), F_OK), 0);
+    EXPECT_NE(access(unusedPath.c_str(), F_OK), 0);
+    remove(cachePath.c_str());
+    remove(linkPath.c_str());
+}
 }
@@ -99,4 +99,81 @@ HWTEST_F(ResConfigTest, TestCompleteScript001, TestSize.Level1)
     EXPECT_TRUE(target->IsCompletedScript());
     target->CompleteScript();
 }
-}
\ No newline at end of file
+
+/*
+ * @tc.name: TestLocaleInfo001
+ * @tc.desc: Test the locale info is built on first access and shared by the copies.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigTest, TestLocaleInfo001, TestSize.Level1)
+{
+    auto rc = std::make_shared<ResConfigImpl>();
+    EXPECT_EQ(SUCCESS, rc->SetLocaleInfo("zh", "Hans", "CN"));
+    EXPECT_TRUE(rc->isLocaleInfoSet());
+    auto copy = std::make_shared<ResConfigImpl>();
+    EXPECT_TRUE(copy->Copy(*rc));
+    const icu::Locale *localeInfo = rc->GetLocaleInfo();
+    ASSERT_TRUE(localeInfo != nullptr);
+    EXPECT_STREQ("zh", localeInfo->getLanguage());
+    EXPECT_STREQ("Hans", localeInfo->getScript());
+    EXPECT_STREQ("CN", localeInfo->getCountry());
+    EXPECT_EQ(localeInfo, rc->GetLocaleInfo());
+    EXPECT_STREQ("Hans", copy->GetLocaleInfo()->getScript());
+
+    auto other = std::make_shared<ResConfigImpl>();
+    EXPECT_TRUE(other->Copy(*rc));
+    EXPECT_EQ(localeInfo, other->GetLocaleInfo());
+    EXPECT_TRUE(other->MatchLocal(*rc));
+
+    EXPECT_EQ(SUCCESS, rc->SetLocaleInfo("en", nullptr, "US"));
+    EXPECT_STREQ("en", rc->GetLocaleInfo()->getLanguage());
+    EXPECT_STREQ("zh", other->GetLocaleInfo()->getLanguage());
+    EXPECT_EQ(nullptr, rc->GetPreferredLocaleInfo());
+}
+
+/*
+ * @tc.name: TestDiff001
+ * @tc.desc: Test Diff.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigTest, TestDiff001, TestSize.Level1)
+{
+    auto current = std::make_shared<ResConfigImpl>();
+    current->SetLocaleInfo("zh", nullptr, "CN");
+    current->SetDirection(DIRECTION_VERTICAL);
+    auto other = std::make_shared<ResConfigImpl>();
+    EXPECT_TRUE(other->Copy(*current));
+    EXPECT_EQ(CONFIG_CHANGE_NONE, current->Diff(*other));
+
+    other->SetDirection(DIRECTION_HORIZONTAL);
+    other->SetScreenDensityDpi(SCREEN_DENSITY_XLDPI);
+    EXPECT_EQ(CONFIG_CHANGE_DIRECTION | CONFIG_CHANGE_DENSITY, current->Diff(*other));
+
+    other->SetLocaleInfo("en", nullptr, "US");
+    other->SetThemeId(1);
+    EXPECT_EQ(CONFIG_CHANGE_LOCALE | CONFIG_CHANGE_DIRECTION | CONFIG_CHANGE_DENSITY | CONFIG_CHANGE_THEME,
+        current->Diff(*other));
+    EXPECT_TRUE(current->Copy(*other));
+    EXPECT_EQ(CONFIG_CHANGE_NONE, current->Diff(*other));
+}
+
+/*
+ * @tc.name: TestDiff002
+ * @tc.desc: Test Diff, an unset device type is the current device as Copy takes it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigTest, TestDiff002, TestSize.Level1)
+{
+    auto update = std::make_shared<ResConfigImpl>();
+    update->SetLocaleInfo("zh", nullptr, "CN");
+    auto current = std::make_shared<ResConfigImpl>();
+    current->SetDeviceType(DEVICE_TV);
+    EXPECT_TRUE(current->Copy(*update));
+    EXPECT_EQ(ResConfigImpl::ParseDeviceTypeStr(ResConfigImpl::GetCurrentDeviceType()), current->GetDeviceType());
+    EXPECT_EQ(CONFIG_CHANGE_NONE, current->Diff(*update));
+
+    // a device type set explicitly is still a change
+    update->SetDeviceType(current->GetDeviceType() == DEVICE_TV ? DEVICE_CAR : DEVICE_TV);
+    EXPECT_EQ(CONFIG_CHANGE_DEVICE_TYPE, current->Diff(*update));
+}
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+#include "ark_native_engine.h"
+#include "resource_manager_data_context.h"
+#include "resource_manager_napi_async_impl.h"
+
+using namespace OHOS::Global::Resource;
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t TEST_ERROR_CODE = 9001001;
+std::atomic<int> g_executeCount { 0 };
+int g_resolveCount = 0;
+int g_rejectCount = 0;
+
+class ResourceManagerNapiAsyncTest : public testing::Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    ResMgrDataContext *CreateDataContext(bool isSuccess);
+
+    panda::ecmascript::EcmaVM *vm_ = nullptr;
+    NativeEngine *engine_ = nullptr;
+    napi_env env_ = nullptr;
+    napi_handle_scope scope_ = nullptr;
+};
+
+void ResourceManagerNapiAsyncTest::SetUp()
+{
+    panda::RuntimeOption option;
+    option.SetGcType(panda::RuntimeOption::GC_TYPE::GEN_GC);
+    option.SetLogLevel(panda::RuntimeOption::LOG_LEVEL::ERROR);
+    vm_ = panda::JSNApi::CreateJSVM(option);
+    ASSERT_TRUE(vm_ != nullptr);
+    engine_ = new ArkNativeEngine(vm_, nullptr);
+    env_ = reinterpret_cast<napi_env>(engine_);
+    napi_open_handle_scope(env_, &scope_);
+    g_executeCount = 0;
+    g_resolveCount = 0;
+    g_rejectCount = 0;
+}
+
+void ResourceManagerNapiAsyncTest::TearDown()
+{
+    napi_close_handle_scope(env_, scope_);
+    delete engine_;
+    engine_ = nullptr;
+    panda::JSNApi::DestroyJSVM(vm_);
+    vm_ = nullptr;
+}
+
+napi_value OnSettled(napi_env env, napi_callback_info info)
+{
+    size_t argc = 2; // the error and the value
+    napi_value argv[2] = { nullptr, nullptr };
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    napi_valuetype errorType = napi_undefined;
+    napi_typeof(env, argv[0], &errorType);
+    if (errorType == napi_undefined) {
+        char value[16] = { 0 };
+        size_t len = 0;
+        napi_get_value_string_utf8(env, argv[1], value, sizeof(value), &len);
+        EXPECT_EQ("value", std::string(value, len));
+        g_resolveCount++;
+    } else {
+        napi_value code = nullptr;
+        napi_get_named_property(env, argv[0], "code", &code);
+        int32_t errCode = 0;
+        napi_get_value_int32(env, code, &errCode);
+        EXPECT_EQ(TEST_ERROR_CODE, errCode);
+        g_rejectCount++;
+    }
+    napi_value result = nullptr;
+    napi_get_undefined(env, &result);
+    return result;
+}
+
+ResMgrDataContext *ResourceManagerNapiAsyncTest::CreateDataContext(bool isSuccess)
+{
+    ResMgrDataContext *dataContext = new ResMgrDataContext();
+    napi_value callback = nullptr;
+    napi_create_function(env_, "onSettled", NAPI_AUTO_LENGTH, OnSettled, nullptr, &callback);
+    napi_create_reference(env_, callback, 1, &dataContext->callbackRef_);
+    if (isSuccess) {
+        dataContext->execute_ = [](napi_env env, void *data) {
+            ResMgrDataContext *context = static_cast<ResMgrDataContext*>(data);
+            context->value_ = "value";
+            g_executeCount++;
+        };
+    } else {
+        dataContext->execute_ = [](napi_env env, void *data) {
+            ResMgrDataContext *context = static_cast<ResMgrDataContext*>(data);
+            context->SetErrorMsg("failed in test", true, TEST_ERROR_CODE);
+            g_executeCount++;
+        };
+    }
+    dataContext->createValueFunc_ = [](napi_env env, ResMgrDataContext &context) -> napi_value {
+        napi_value value = nullptr;
+        napi_create_string_utf8(env, context.value_.c_str(), NAPI_AUTO_LENGTH, &value);
+        return value;
+    };
+    return dataContext;
+}
+
+/*
+ * @tc.name: ResourceManagerNapiAsyncBatchTest001
+ * @tc.desc: Test GetRequestCost, the media and raw file reads are heavy.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerNapiAsyncTest, ResourceManagerNapiAsyncBatchTest001, TestSize.Level1)
+{
+    EXPECT_EQ(ResourceManagerNapiAsyncImpl::LIGHT_REQUEST_COST,
+        ResourceManagerNapiAsyncImpl::GetRequestCost("getStringValue"));
+    EXPECT_EQ(ResourceManagerNapiAsyncImpl::LIGHT_REQUEST_COST,
+        ResourceManagerNapiAsyncImpl::GetRequestCost("getRawFd"));
+    EXPECT_EQ(ResourceManagerNapiAsyncImpl::HEAVY_REQUEST_COST,
+        ResourceManagerNapiAsyncImpl::GetRequestCost("getMediaContent"));
+    EXPECT_EQ(ResourceManagerNapiAsyncImpl::HEAVY_REQUEST_COST,
+        ResourceManagerNapiAsyncImpl::GetRequestCost("getRawFileContent"));
+}
+
+/*
+ * @tc.name: ResourceManagerNapiAsyncBatchTest002
+ * @tc.desc: Test AddToPendingBatch, a request exceeding the cost of the pending batch starts a new work.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerNapiAsyncTest, ResourceManagerNapiAsyncBatchTest002, TestSize.Level1)
+{
+    // a pending batch which is not queued, so the worker never takes it
+    ResourceManagerNapiAsyncImpl::AsyncBatch *pendingBatch = new ResourceManagerNapiAsyncImpl::AsyncBatch();
+    pendingBatch->cost = ResourceManagerNapiAsyncImpl::MAX_BATCH_COST - 1;
+    ResourceManagerNapiAsyncImpl::pendingBatches_[env_] = pendingBatch;
+
+    std::unique_ptr<ResMgrDataContext> light(CreateDataContext(true));
+    ASSERT_TRUE(ResourceManagerNapiAsyncImpl::AddToPendingBatch(env_, light, "getStringValue"));
+    EXPECT_EQ(ResourceManagerNapiAsyncImpl::MAX_BATCH_COST, pendingBatch->cost);
+    EXPECT_EQ(1, pendingBatch->dataContexts.size());
+
+    std::unique_ptr<ResMgrDataContext> next(CreateDataContext(true));
+    ASSERT_TRUE(ResourceManagerNapiAsyncImpl::AddToPendingBatch(env_, next, "getStringValue"));
+    EXPECT_EQ(1, pendingBatch->dataContexts.size());
+
+    // settle the request kept in the batch which is never queued
+    for (auto dataContext : pendingBatch->dataContexts) {
+        dataContext->execute_(env_, dataContext);
+        ResourceManagerNapiAsyncImpl::SettleResult(env_, dataContext);
+        delete dataContext;
+    }
+    delete pendingBatch;
+    engine_->Loop(LOOP_DEFAULT);
+    EXPECT_EQ(2, g_executeCount.load());
+    EXPECT_EQ(2, g_resolveCount);
+}
+
+/*
+ * @tc.name: ResourceManagerNapiAsyncBatchTest003
+ * @tc.desc: Test AddToPendingBatch, a heavy request never joins a pending batch.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerNapiAsyncTest, ResourceManagerNapiAsyncBatchTest003, TestSize.Level1)
+{
+    ResourceManagerNapiAsyncImpl::AsyncBatch *pendingBatch = new ResourceManagerNapiAsyncImpl::AsyncBatch();
+    pendingBatch->cost = ResourceManagerNapiAsyncImpl::LIGHT_REQUEST_COST;
+    ResourceManagerNapiAsyncImpl::pendingBatches_[env_] = pendingBatch;
+
+    std::unique_ptr<ResMgrDataContext> heavy(CreateDataContext(true));
+    ASSERT_TRUE(ResourceManagerNapiAsyncImpl::AddToPendingBatch(env_, heavy, "getMediaContent"));
+    EXPECT_EQ(0, pendingBatch->dataContexts.size());
+    EXPECT_EQ(ResourceManagerNapiAsyncImpl::LIGHT_REQUEST_COST, pendingBatch->cost);
+    delete pendingBatch;
+
+    engine_->Loop(LOOP_DEFAULT);
+    EXPECT_EQ(1, g_executeCount.load());
+    EXPECT_EQ(1, g_resolveCount);
+}
+
+/*
+ * @tc.name: ResourceManagerNapiAsyncBatchTest004
+ * @tc.desc: Test the batched requests, each one is executed once and settled with its own result.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerNapiAsyncTest, ResourceManagerNapiAsyncBatchTest004, TestSize.Level1)
+{
+    const int count = static_cast<int>(ResourceManagerNapiAsyncImpl::MAX_BATCH_COST) * 2 + 1;
+    for (int i = 0; i < count; i++) {
+        std::unique_ptr<ResMgrDataContext> dataContext(CreateDataContext(i % 2 == 0));
+        ASSERT_TRUE(ResourceManagerNapiAsyncImpl::AddToPendingBatch(env_, dataContext, "getStringValue"));
+    }
+    engine_->Loop(LOOP_DEFAULT);
+    EXPECT_EQ(count, g_executeCount.load());
+    EXPECT_EQ(count / 2 + 1, g_resolveCount);
+    EXPECT_EQ(count / 2, g_rejectCount);
+    EXPECT_TRUE(ResourceManagerNapiAsyncImpl::pendingBatches_.find(env_) ==
+        ResourceManagerNapiAsyncImpl::pendingBatches_.end());
+}
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ark_native_engine.h"
+#include "resource_manager.h"
+#include "resource_manager_addon.h"
+#include "resource_manager_data_context.h"
+
+using namespace OHOS::Global::Resource;
+using namespace testing::ext;
+
+namespace {
+const char *RES_INDEX_PATH = "/data/test/all/assets/entry/resources.index";
+
+struct TestEnv {
+    panda::ecmascript::EcmaVM *vm = nullptr;
+    NativeEngine *engine = nullptr;
+    napi_env env = nullptr;
+    napi_handle_scope scope = nullptr;
+};
+
+class ResourceManagerNapiSendableTest : public testing::Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    static bool CreateEnv(TestEnv &testEnv);
+    static void DestroyEnv(TestEnv &testEnv);
+
+    TestEnv testEnv_;
+    std::shared_ptr<ResourceManagerAddon> addon_;
+};
+
+bool ResourceManagerNapiSendableTest::CreateEnv(TestEnv &testEnv)
+{
+    panda::RuntimeOption option;
+    option.SetGcType(panda::RuntimeOption::GC_TYPE::GEN_GC);
+    option.SetLogLevel(panda::RuntimeOption::LOG_LEVEL::ERROR);
+    testEnv.vm = panda::JSNApi::CreateJSVM(option);
+    if (testEnv.vm == nullptr) {
+        return false;
+    }
+    testEnv.engine = new ArkNativeEngine(testEnv.vm, nullptr);
+    testEnv.env = reinterpret_cast<napi_env>(testEnv.engine);
+    napi_open_handle_scope(testEnv.env, &testEnv.scope);
+    return true;
+}
+
+void ResourceManagerNapiSendableTest::DestroyEnv(TestEnv &testEnv)
+{
+    napi_close_handle_scope(testEnv.env, testEnv.scope);
+    delete testEnv.engine;
+    testEnv.engine = nullptr;
+    panda::JSNApi::DestroyJSVM(testEnv.vm);
+    testEnv.vm = nullptr;
+}
+
+void ResourceManagerNapiSendableTest::SetUp()
+{
+    ASSERT_TRUE(CreateEnv(testEnv_));
+    std::shared_ptr<ResourceManager> resMgr(CreateResourceManager());
+    ASSERT_TRUE(resMgr != nullptr);
+    std::unique_ptr<ResConfig> resConfig(CreateResConfig());
+    ASSERT_TRUE(resConfig != nullptr);
+    resConfig->SetLocaleInfo("en", nullptr, nullptr);
+    resMgr->UpdateResConfig(*resConfig);
+    ASSERT_TRUE(resMgr->AddResource(RES_INDEX_PATH));
+    addon_ = std::make_shared<ResourceManagerAddon>(resMgr);
+}
+
+void ResourceManagerNapiSendableTest::TearDown()
+{
+    addon_ = nullptr;
+    DestroyEnv(testEnv_);
+}
+
+std::string CallStringGetter(napi_env env, napi_value object, const char *getter, const char *name)
+{
+    napi_value func = nullptr;
+    if (napi_get_named_property(env, object, getter, &func) != napi_ok) {
+        return "";
+    }
+    napi_value argv[1] = { nullptr };
+    napi_create_string_utf8(env, name, NAPI_AUTO_LENGTH, &argv[0]);
+    napi_value result = nullptr;
+    if (napi_call_function(env, object, func, 1, argv, &result) != napi_ok) {
+        return "";
+    }
+    char value[64] = { 0 };
+    size_t len = 0;
+    if (napi_get_value_string_utf8(env, result, value, sizeof(value), &len) != napi_ok) {
+        return "";
+    }
+    return std::string(value, len);
+}
+
+/*
+ * @tc.name: ResourceManagerNapiSendableTest001
+ * @tc.desc: Test the sendable resource manager, it shares the addon and its getters read the same resources.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerNapiSendableTest, ResourceManagerNapiSendableTest001, TestSize.Level1)
+{
+    napi_env env = testEnv_.env;
+    napi_value sendable = ResourceManagerAddon::WrapSendableResourceManager(env, addon_);
+    ASSERT_TRUE(sendable != nullptr);
+    EXPECT_EQ("App Name", CallStringGetter(env, sendable, "getStringByNameSync", "app_name"));
+
+    // the getters unwrap the same native addon from the sendable object
+    std::shared_ptr<ResourceManagerAddon> *addonPtr = nullptr;
+    ASSERT_EQ(napi_ok, napi_unwrap_sendable(env, sendable, reinterpret_cast<void **>(&addonPtr)));
+    ASSERT_TRUE(addonPtr != nullptr);
+    EXPECT_EQ(addon_.get(), addonPtr->get());
+    EXPECT_EQ(addon_, ResMgrDataContext::UnwrapAddon(env, sendable));
+}
+
+/*
+ * @tc.name: ResourceManagerNapiSendableTest002
+ * @tc.desc: Test GetSendableConstructor, the sendable class is defined once per env.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerNapiSendableTest, ResourceManagerNapiSendableTest002, TestSize.Level1)
+{
+    TestEnv otherEnv;
+    ASSERT_TRUE(CreateEnv(otherEnv));
+    for (napi_env env : { testEnv_.env, otherEnv.env }) {
+        napi_value constructor = ResourceManagerAddon::GetSendableConstructor(env);
+        ASSERT_TRUE(constructor != nullptr);
+        napi_value cached = ResourceManagerAddon::GetSendableConstructor(env);
+        ASSERT_TRUE(cached != nullptr);
+        bool isEqual = false;
+        napi_strict_equals(env, constructor, cached, &isEqual);
+        EXPECT_TRUE(isEqual);
+
+        napi_value sendable = ResourceManagerAddon::WrapSendableResourceManager(env, addon_);
+        ASSERT_TRUE(sendable != nullptr);
+        bool isInstance = false;
+        napi_instanceof(env, sendable, constructor, &isInstance);
+        EXPECT_TRUE(isInstance);
+        EXPECT_EQ("App Name", CallStringGetter(env, sendable, "getStringByNameSync", "app_name"));
+    }
+    DestroyEnv(otherEnv);
+
+    // the env left is not affected by the other one
+    napi_value sendable = ResourceManagerAddon::WrapSendableResourceManager(testEnv_.env, addon_);
+    ASSERT_TRUE(sendable != nullptr);
+    EXPECT_EQ("App Name", CallStringGetter(testEnv_.env, sendable, "getStringByNameSync", "app_name"));
+}
+}
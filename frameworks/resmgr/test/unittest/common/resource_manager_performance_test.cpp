@@ -1544,4 +1544,65 @@ HWTEST_F(ResourceManagerPerformanceTest, ResourceManagerPerformanceFuncTest064,
     int ret = TestLoadFromNewIndex(PERFOR_FEIL_V2_PATH);
     EXPECT_EQ(OK, ret);
 };
+
+/*
+ * @tc.name: ResourceManagerPerformanceFuncTest065
+ * @tc.desc: Test GetResourcesByIds, compare the cost per lookup with the single getters
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerPerformanceTest, ResourceManagerPerformanceFuncTest065, TestSize.Level1)
+{
+    if (rm == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    std::vector<ResourceManager::BatchItem> items;
+    const std::vector<std::pair<std::string, ResType>> resources = {
+        {"app_name", ResType::STRING}, {"divider_color", ResType::COLOR},
+        {"width_appBar_backButton_touchTarget", ResType::FLOAT}, {"integer_1", ResType::INTEGER},
+        {"boolean_1", ResType::BOOLEAN}
+    };
+    for (int k = 0; k < 20; ++k) {
+        for (const auto &resource : resources) {
+            ResourceManager::BatchItem item;
+            item.id = GetResId(resource.first, resource.second);
+            ASSERT_TRUE(item.id > 0);
+            item.type = resource.second;
+            items.emplace_back(item);
+        }
+    }
+    unsigned long long batchTotal = 0;
+    unsigned long long singleTotal = 0;
+    for (int k = 0; k < 100; ++k) {
+        std::string arena;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        rm->GetResourcesByIds(items, arena);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        for (const auto &item : items) {
+            std::string strValue;
+            uint32_t colorValue;
+            float floatValue;
+            int intValue;
+            bool boolValue;
+            if (item.type == ResType::STRING) {
+                rm->GetStringById(item.id, strValue);
+            } else if (item.type == ResType::COLOR) {
+                rm->GetColorById(item.id, colorValue);
+            } else if (item.type == ResType::FLOAT) {
+                rm->GetFloatById(item.id, floatValue);
+            } else if (item.type == ResType::INTEGER) {
+                rm->GetIntegerById(item.id, intValue);
+            } else {
+                rm->GetBooleanById(item.id, boolValue);
+            }
+        }
+        auto t3 = std::chrono::high_resolution_clock::now();
+        batchTotal += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        singleTotal += std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count();
+    }
+    double batchAverage = batchTotal / (100.0 * items.size());
+    double singleAverage = singleTotal / (100.0 * items.size());
+    g_logLevel = LOG_DEBUG;
+    RESMGR_HILOGD(RESMGR_TAG, "avg cost 065: batch %f us, single %f us", batchAverage, singleAverage);
+    EXPECT_LT(batchAverage, singleAverage);
+};
 }
@@ -69,6 +69,7 @@ int ResourceManagerPerformanceFuncTest056(void);
 int ResourceManagerPerformanceFuncTest057(void);
 int ResourceManagerPerformanceFuncTest059(void);
 int ResourceManagerPerformanceFuncTest063(void);
+int ResourceManagerPerformanceFuncTest065(void);
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
@@ -2875,6 +2875,44 @@ HWTEST_F(ResourceManagerTest, CreateResourceManagerTest002, TestSize.Level1)
     delete rc;
 }
 
+/*
+ * @tc.name: CreateResourceManagerTest003
+ * @tc.desc: Test CreateResourceManager function, the resource managers of the same hap share the resources
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, CreateResourceManagerTest003, TestSize.Level1)
+{
+    ResConfigImpl *rc = new ResConfigImpl;
+    std::string hapPath = FormatFullPath(g_resFilePath);
+    std::vector<std::string> overlayPath;
+    int32_t appType = 0;
+    int32_t userId = 100; // userId is 100
+    std::shared_ptr<ResourceManager> firstRm =
+        CreateResourceManager("ohos.global.test.all", "entry", hapPath, overlayPath, *rc, appType, userId);
+    ASSERT_TRUE(firstRm != nullptr);
+    ASSERT_TRUE(firstRm->AddResource(hapPath.c_str()));
+    rc->SetLocaleInfo("zh", nullptr, "CN");
+    ASSERT_EQ(SUCCESS, firstRm->UpdateResConfig(*rc));
+
+    std::shared_ptr<ResourceManager> secondRm =
+        CreateResourceManager("ohos.global.test.all", "entry", hapPath, overlayPath, *rc, appType, userId);
+    ASSERT_TRUE(secondRm != nullptr);
+    ASSERT_TRUE(secondRm->AddResource(hapPath.c_str()));
+    auto firstHaps = std::static_pointer_cast<ResourceManagerImpl>(firstRm)->GetHapManager()->GetHapResource();
+    auto secondHaps = std::static_pointer_cast<ResourceManagerImpl>(secondRm)->GetHapManager()->GetHapResource();
+    ASSERT_EQ(firstHaps, secondHaps);
+
+    // the config of the shared one is copied on write
+    rc->SetLocaleInfo("en", nullptr, "US");
+    ASSERT_EQ(SUCCESS, secondRm->UpdateResConfig(*rc));
+    ResConfigImpl firstConfig;
+    firstRm->GetResConfig(firstConfig);
+#ifdef SUPPORT_GRAPHICS
+    EXPECT_EQ("zh", std::string(firstConfig.GetLocaleInfo()->getLanguage()));
+#endif
+    delete rc;
+}
+
 /*
  * @tc.name: GetSystemResourceManagerTest001
  * @tc.desc: Test CreateResourceManager function
@@ -3026,6 +3064,25 @@ HWTEST_F(ResourceManagerTest, GetProfileDataByIdTest001, TestSize.Level1)
     ASSERT_EQ(ERROR_CODE_RES_NOT_FOUND_BY_ID, state);
 }
 
+/*
+ * @tc.name: GetProfileDataByIdTest002
+ * @tc.desc: Test GetProfileDataById function, the profile of an unpacked resources.index is read from the mapping
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, GetProfileDataByIdTest002, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    int id = rmc->GetResId("test_profile", ResType::PROF);
+    ASSERT_TRUE(id > 0);
+    size_t len = 0;
+    std::unique_ptr<uint8_t[]> outValue;
+    RState state = rm->GetProfileDataById(id, len, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_TRUE(outValue != nullptr);
+    EXPECT_EQ(std::string("{\"src\": [\"test for profile\"]}"),
+        std::string(reinterpret_cast<char *>(outValue.get()), len));
+}
+
 /*
  * @tc.name: GetDrawableInfoByIdTest001
  * @tc.desc: Test GetDrawableInfoById function
@@ -3135,4 +3192,252 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetResNameTest003, TestSize.Level1)
     ASSERT_EQ(state, ERROR_CODE_RES_ID_NOT_FOUND);
     ASSERT_EQ(resName, "");
 }
-}
\ No newline at end of file
+
+/*
+ * @tc.name: ResourceManagerGetResourcesByIdsTest001
+ * @tc.desc: Test GetResourcesByIds function
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetResourcesByIdsTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    std::vector<ResourceManager::BatchItem> items(7);
+    items[0].id = rmc->GetResId("app_name", ResType::STRING);
+    items[0].type = ResType::STRING;
+    items[1].id = rmc->GetResId("divider_color", ResType::COLOR);
+    items[1].type = ResType::COLOR;
+    items[2].id = rmc->GetResId("width_appBar_backButton_touchTarget", ResType::FLOAT);
+    items[2].type = ResType::FLOAT;
+    items[3].id = rmc->GetResId("integer_1", ResType::INTEGER);
+    items[3].type = ResType::INTEGER;
+    items[4].id = rmc->GetResId("boolean_1", ResType::BOOLEAN);
+    items[4].type = ResType::BOOLEAN;
+    items[5].id = NON_EXIST_ID;
+    items[5].type = ResType::STRING;
+    items[6].id = items[0].id;
+    items[6].type = ResType::MEDIA;
+    std::string arena;
+    RState state = rm->GetResourcesByIds(items, arena);
+    ASSERT_EQ(NOT_FOUND, state);
+
+    std::string strValue;
+    ASSERT_EQ(SUCCESS, rm->GetStringById(items[0].id, strValue));
+    ASSERT_EQ(SUCCESS, items[0].state);
+    ASSERT_EQ(strValue, std::string(arena.c_str() + items[0].stringOffset, items[0].stringLen));
+    ASSERT_EQ('\0', arena[items[0].stringOffset + items[0].stringLen]);
+    uint32_t colorValue = 0;
+    ASSERT_EQ(SUCCESS, rm->GetColorById(items[1].id, colorValue));
+    ASSERT_EQ(SUCCESS, items[1].state);
+    ASSERT_EQ(colorValue, items[1].colorValue);
+    float floatValue = 0.0f;
+    ASSERT_EQ(SUCCESS, rm->GetFloatById(items[2].id, floatValue));
+    ASSERT_EQ(SUCCESS, items[2].state);
+    ASSERT_EQ(floatValue, items[2].floatValue);
+    int intValue = 0;
+    ASSERT_EQ(SUCCESS, rm->GetIntegerById(items[3].id, intValue));
+    ASSERT_EQ(SUCCESS, items[3].state);
+    ASSERT_EQ(intValue, items[3].intValue);
+    bool boolValue = false;
+    ASSERT_EQ(SUCCESS, rm->GetBooleanById(items[4].id, boolValue));
+    ASSERT_EQ(SUCCESS, items[4].state);
+    ASSERT_EQ(boolValue, items[4].boolValue);
+    ASSERT_EQ(ERROR_CODE_RES_ID_NOT_FOUND, items[5].state);
+    ASSERT_EQ(ERROR_CODE_INVALID_INPUT_PARAMETER, items[6].state);
+}
+
+/*
+ * @tc.name: ResourceManagerGetResourcesByIdsTest002
+ * @tc.desc: Test GetResourcesByIds function with the type mismatch
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetResourcesByIdsTest002, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    std::vector<ResourceManager::BatchItem> items(1);
+    items[0].id = rmc->GetResId("app_name", ResType::STRING);
+    items[0].type = ResType::INTEGER;
+    std::string arena;
+    RState state = rm->GetResourcesByIds(items, arena);
+    ASSERT_EQ(NOT_FOUND, state);
+    ASSERT_EQ(ERROR_CODE_RES_NOT_FOUND_BY_ID, items[0].state);
+    ASSERT_TRUE(arena.empty());
+
+    items.clear();
+    state = rm->GetResourcesByIds(items, arena);
+    ASSERT_EQ(SUCCESS, state);
+}
+
+/*
+ * @tc.name: ResourceManagerGetResourceHandleTest001
+ * @tc.desc: Test GetStringByHandle and GetColorByHandle function
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetResourceHandleTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    uint32_t id = rmc->GetResId("app_name", ResType::STRING);
+    auto stringHandle = rm->GetResourceHandle(id);
+    ASSERT_TRUE(stringHandle != nullptr);
+    std::string expectString;
+    ASSERT_EQ(SUCCESS, rm->GetStringById(id, expectString));
+    std::string outString;
+    ASSERT_EQ(SUCCESS, rm->GetStringByHandle(stringHandle, outString));
+    ASSERT_EQ(expectString, outString);
+    // the second lookup hits the resolved resource
+    outString.clear();
+    ASSERT_EQ(SUCCESS, rm->GetStringByHandle(stringHandle, outString));
+    ASSERT_EQ(expectString, outString);
+
+    auto colorHandle = rm->GetResourceHandleByName("divider_color", ResType::COLOR);
+    ASSERT_TRUE(colorHandle != nullptr);
+    uint32_t expectColor = 0;
+    ASSERT_EQ(SUCCESS, rm->GetColorByName("divider_color", expectColor));
+    uint32_t outColor = 0;
+    ASSERT_EQ(SUCCESS, rm->GetColorByHandle(colorHandle, outColor));
+    ASSERT_EQ(expectColor, outColor);
+
+    ASSERT_EQ(ERROR_CODE_RES_NOT_FOUND_BY_ID, rm->GetColorByHandle(stringHandle, outColor));
+    ASSERT_TRUE(rm->GetResourceHandle(NON_EXIST_ID) == nullptr);
+    ASSERT_TRUE(rm->GetResourceHandleByName("not_exist_name", ResType::STRING) == nullptr);
+}
+
+/*
+ * @tc.name: ResourceManagerGetResourceHandleTest002
+ * @tc.desc: Test GetStringByHandle function after the config is updated
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetResourceHandleTest002, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    uint32_t id = rmc->GetResId("app_name", ResType::STRING);
+    auto handle = rm->GetResourceHandle(id);
+    ASSERT_TRUE(handle != nullptr);
+    std::string outValue;
+    ASSERT_EQ(SUCCESS, rm->GetStringByHandle(handle, outValue));
+
+    ResConfig *rc = CreateResConfig();
+    if (rc == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    rc->SetLocaleInfo("en", nullptr, "US");
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    delete rc;
+    std::string expectValue;
+    ASSERT_EQ(SUCCESS, rm->GetStringById(id, expectValue));
+    outValue.clear();
+    ASSERT_EQ(SUCCESS, rm->GetStringByHandle(handle, outValue));
+    ASSERT_EQ(expectValue, outValue);
+
+    std::shared_ptr<ResourceManager::ResourceHandle> nullHandle;
+    ASSERT_EQ(ERROR_CODE_INVALID_INPUT_PARAMETER, rm->GetStringByHandle(nullHandle, outValue));
+}
+
+/*
+ * @tc.name: ResourceManagerGetResourceGenerationTest001
+ * @tc.desc: Test GetResourceGeneration function
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetResourceGenerationTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    uint64_t generation = rm->GetResourceGeneration();
+    ASSERT_EQ(generation, rm->GetResourceGeneration());
+
+    ResConfig *rc = CreateResConfig();
+    if (rc == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    rc->SetLocaleInfo("en", nullptr, "US");
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    delete rc;
+    ASSERT_NE(generation, rm->GetResourceGeneration());
+}
+
+/*
+ * @tc.name: ResourceManagerGetSharedIntArrayTest001
+ * @tc.desc: Test GetSharedIntArrayById and GetSharedIntArrayByName function
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetSharedIntArrayTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+
+    int id = rmc->GetResId("intarray_1", ResType::INTARRAY);
+    ASSERT_TRUE(id > 0);
+    std::shared_ptr<const std::vector<int32_t>> outValue;
+    ASSERT_EQ(SUCCESS, rm->GetSharedIntArrayById(id, outValue));
+    ASSERT_NE(nullptr, outValue);
+    ASSERT_EQ(static_cast<size_t>(3), outValue->size()); // 3 means the size of int array resource
+    EXPECT_EQ(100, (*outValue)[0]); // 100 means the first value of int array
+    EXPECT_EQ(200, (*outValue)[1]); // 200 means the second value of int array
+    EXPECT_EQ(101, (*outValue)[2]); // 101 means the third value of int array
+
+    // the resolved array is shared until the resource generation changes
+    std::shared_ptr<const std::vector<int32_t>> cachedValue;
+    ASSERT_EQ(SUCCESS, rm->GetSharedIntArrayByName("intarray_1", cachedValue));
+    ASSERT_EQ(outValue.get(), cachedValue.get());
+
+    ResConfig *rc = CreateResConfig();
+    if (rc == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    rc->SetLocaleInfo("en", nullptr, "US");
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    delete rc;
+    ASSERT_EQ(SUCCESS, rm->GetSharedIntArrayById(id, cachedValue));
+    ASSERT_NE(outValue.get(), cachedValue.get());
+
+    ASSERT_EQ(NOT_FOUND, rm->GetSharedIntArrayById(NON_EXIST_ID, outValue));
+    ASSERT_EQ(NOT_FOUND, rm->GetSharedIntArrayByName(g_nonExistName, outValue));
+}
+
+/*
+ * @tc.name: ResourceManagerGetConfigGenerationTest001
+ * @tc.desc: Test GetConfigGeneration function
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetConfigGenerationTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    uint64_t generation = rm->GetConfigGeneration();
+    ASSERT_EQ(generation, rm->GetConfigGeneration());
+
+    ResConfig *rc = CreateResConfig();
+    if (rc == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    rc->SetLocaleInfo("en", nullptr, "US");
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    delete rc;
+    ASSERT_NE(generation, rm->GetConfigGeneration());
+}
+
+/*
+ * @tc.name: ResourceManagerGetLastConfigChangesTest001
+ * @tc.desc: Test GetLastConfigChanges function
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetLastConfigChangesTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+    ResConfig *rc = CreateResConfig();
+    if (rc == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    rm->GetResConfig(*rc);
+    uint64_t generation = rm->GetConfigGeneration();
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    ASSERT_EQ(generation, rm->GetConfigGeneration());
+
+    rc->SetColorMode(rc->GetColorMode() == DARK ? LIGHT : DARK);
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    ASSERT_NE(generation, rm->GetConfigGeneration());
+    ASSERT_EQ(CONFIG_CHANGE_COLOR_MODE, rm->GetLastConfigChanges());
+
+    rc->SetLocaleInfo("en", nullptr, "US");
+    rc->SetDirection(rc->GetDirection() == DIRECTION_VERTICAL ? DIRECTION_HORIZONTAL : DIRECTION_VERTICAL);
+    ASSERT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    delete rc;
+    ASSERT_EQ(CONFIG_CHANGE_LOCALE | CONFIG_CHANGE_DIRECTION, rm->GetLastConfigChanges());
+}
+}
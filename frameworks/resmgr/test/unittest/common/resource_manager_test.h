@@ -136,12 +136,20 @@ int ResourceManagerIsRawDirFromHap002(void);
 int ResourceManagerGetRawFileList001(void);
 int ResourceManagerGetRawFileList002(void);
 int CreateResourceManagerTest001(void);
+int CreateResourceManagerTest003(void);
 int GetSystemResourceManagerTest001(void);
 int CloseRawFileDescriptorTest001(void);
 int CloseRawFileDescriptorTest002(void);
 int CloseRawFileDescriptorTest003(void);
 int AddSystemResourceTest001(void);
 int AddSystemResourceTest002(void);
+int ResourceManagerGetResourcesByIdsTest001(void);
+int ResourceManagerGetResourcesByIdsTest002(void);
+int ResourceManagerGetResourceHandleTest001(void);
+int ResourceManagerGetResourceHandleTest002(void);
+int ResourceManagerGetResourceGenerationTest001(void);
+int ResourceManagerGetSharedIntArrayTest001(void);
+int ResourceManagerGetConfigGenerationTest001(void);
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #include "resource_manager_test_hap.h"
 
 #include "resource_manager_test_common.h"
+#include "media_cache.h"
 
 using namespace OHOS::Global::Resource;
 using namespace testing::ext;
@@ -1425,4 +1426,253 @@ HWTEST_F(ResourceManagerTestHap, ResourceManagerGetDrawableInfoByNameFromHapTest
     rmc->TestGetDrawableInfoWithDensityByName(tmp);
     delete tmp;
 }
+
+/*
+ * @tc.name: ResourceManagerGetSharedMediaDataByIdFromHapTest001
+ * @tc.desc: Test GetSharedMediaDataById, the second read hits the media cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerGetSharedMediaDataByIdFromHapTest001, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    MediaCache::GetInstance().Clear();
+
+    int id = rmc->GetResId("icon1", ResType::MEDIA);
+    EXPECT_TRUE(id > 0);
+    std::shared_ptr<const uint8_t[]> firstValue;
+    size_t firstLen = 0;
+    RState state = rm->GetSharedMediaDataById(id, firstLen, firstValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(firstLen, static_cast<size_t>(5997)); // the length of icon1
+
+    uint64_t hits = MediaCache::GetInstance().GetStatistics().hits;
+    std::shared_ptr<const uint8_t[]> secondValue;
+    size_t secondLen = 0;
+    state = rm->GetSharedMediaDataById(id, secondLen, secondValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(firstLen, secondLen);
+    EXPECT_EQ(firstValue.get(), secondValue.get());
+    EXPECT_EQ(hits + 1, MediaCache::GetInstance().GetStatistics().hits);
+
+    std::unique_ptr<uint8_t[]> outValue;
+    size_t len = 0;
+    state = rm->GetMediaDataById(id, len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(len, firstLen);
+    EXPECT_NE(outValue.get(), firstValue.get());
+    EXPECT_EQ(memcmp(outValue.get(), firstValue.get(), len), 0);
+}
+
+/*
+ * @tc.name: ResourceManagerGetMediaDataCacheFromHapTest001
+ * @tc.desc: Test GetMediaDataById fills the media cache only if the entry fits
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerGetMediaDataCacheFromHapTest001, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    MediaCache::GetInstance().Clear();
+
+    int id = rmc->GetResId("icon1", ResType::MEDIA);
+    EXPECT_TRUE(id > 0);
+    std::unique_ptr<uint8_t[]> outValue;
+    size_t len = 0;
+    RState state = rm->GetMediaDataById(id, len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(len, static_cast<size_t>(5997)); // the length of icon1
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(1));
+
+    std::shared_ptr<const uint8_t[]> sharedValue;
+    size_t sharedLen = 0;
+    state = rm->GetSharedMediaDataById(id, sharedLen, sharedValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(sharedLen, len);
+    EXPECT_EQ(memcmp(outValue.get(), sharedValue.get(), len), 0);
+
+    MediaCache::Statistics statistics = MediaCache::GetInstance().GetStatistics();
+    MediaCache::GetInstance().SetCapacity(len);
+    MediaCache::GetInstance().Clear();
+    EXPECT_FALSE(MediaCache::GetInstance().IsCacheable(len));
+    state = rm->GetMediaDataById(id, len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(0));
+    MediaCache::GetInstance().SetCapacity(statistics.capacity);
+}
+
+/*
+ * @tc.name: ResourceManagerGetSharedMediaDataByNameFromHapTest001
+ * @tc.desc: Test GetSharedMediaDataByName and the media cache budget
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerGetSharedMediaDataByNameFromHapTest001, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    MediaCache::GetInstance().Clear();
+
+    std::shared_ptr<const uint8_t[]> outValue;
+    size_t len = 0;
+    RState state = rm->GetSharedMediaDataByName("icon1", len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(1));
+
+    // the entry larger than a quarter of the budget is not cached
+    MediaCache::Statistics statistics = MediaCache::GetInstance().GetStatistics();
+    MediaCache::GetInstance().SetCapacity(len);
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(1));
+    MediaCache::GetInstance().Clear();
+    state = rm->GetSharedMediaDataByName("icon1", len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(0));
+
+    MediaCache::GetInstance().SetCapacity(statistics.capacity);
+    state = rm->GetSharedMediaDataByName(g_nonExistName, len, outValue);
+    EXPECT_EQ(state, ERROR_CODE_RES_NAME_NOT_FOUND);
+}
+
+/*
+ * @tc.name: ResourceManagerPrefetchFromHapTest001
+ * @tc.desc: Test Prefetch, the prefetched media and rawfile are read from the media cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerPrefetchFromHapTest001, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    MediaCache::GetInstance().Clear();
+
+    int id = rmc->GetResId("icon1", ResType::MEDIA);
+    EXPECT_TRUE(id > 0);
+    ResourceManager::PrefetchRequest request;
+    request.ids.push_back(id);
+    request.names.push_back("icon1");
+    request.rawFiles.push_back("test_rawfile.txt");
+    auto handle = rm->Prefetch(request);
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_EQ(handle->Wait(), SUCCESS);
+    EXPECT_TRUE(handle->IsFinished());
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(2));
+
+    uint64_t hits = MediaCache::GetInstance().GetStatistics().hits;
+    std::unique_ptr<uint8_t[]> outValue;
+    size_t len = 0;
+    RState state = rm->GetMediaDataById(id, len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(len, static_cast<size_t>(5997)); // the length of icon1
+    state = rm->GetRawFileFromHap("test_rawfile.txt", len, outValue);
+    EXPECT_EQ(state, SUCCESS);
+    EXPECT_EQ(len, static_cast<size_t>(17)); // 17 means the length of "for raw file test" in "test_rawfile.txt"
+    EXPECT_EQ(hits + 2, MediaCache::GetInstance().GetStatistics().hits);
+}
+
+/*
+ * @tc.name: ResourceManagerPrefetchFromHapTest002
+ * @tc.desc: Test Prefetch with invalid resources and cancel
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerPrefetchFromHapTest002, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    MediaCache::GetInstance().Clear();
+
+    ResourceManager::PrefetchRequest request;
+    EXPECT_TRUE(rm->Prefetch(request) == nullptr);
+
+    request.names.push_back(g_nonExistName);
+    auto handle = rm->Prefetch(request);
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_EQ(handle->Wait(), NOT_FOUND);
+
+    request.names.clear();
+    request.names.push_back("icon1");
+    request.rawFiles.push_back("non_exist_rawfile.txt");
+    handle = rm->Prefetch(request);
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_TRUE(handle->WaitFor(1000)); // 1000 means wait at most 1s
+    EXPECT_EQ(handle->Wait(), NOT_FOUND);
+
+    handle = rm->Prefetch(request);
+    ASSERT_TRUE(handle != nullptr);
+    handle->Cancel();
+    EXPECT_TRUE(handle->IsFinished());
+    EXPECT_EQ(handle->Wait(), ERROR);
+}
+
+/*
+ * @tc.name: ResourceManagerPrefetchFromHapTest003
+ * @tc.desc: Test Prefetch of the rawfile too large for the media cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerPrefetchFromHapTest003, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    MediaCache::Statistics statistics = MediaCache::GetInstance().GetStatistics();
+    MediaCache::GetInstance().Clear();
+    MediaCache::GetInstance().SetCapacity(16); // 16 means less than 4 times the length of test_rawfile.txt
+
+    ResourceManager::PrefetchRequest request;
+    request.rawFiles.push_back("test_rawfile.txt");
+    auto handle = rm->Prefetch(request);
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_EQ(handle->Wait(), NOT_FOUND);
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(0));
+
+    std::unique_ptr<uint8_t[]> outValue;
+    size_t len = 0;
+    EXPECT_EQ(rm->GetRawFileFromHap("test_rawfile.txt", len, outValue), SUCCESS);
+    EXPECT_EQ(len, static_cast<size_t>(17)); // 17 means the length of "for raw file test" in "test_rawfile.txt"
+    MediaCache::GetInstance().SetCapacity(statistics.capacity);
+}
+
+/*
+ * @tc.name: ResourceManagerPreloadFromHapTest001
+ * @tc.desc: Test Preload with the ids recorded by StartPreloadRecord
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerPreloadFromHapTest001, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    int id = rmc->GetResId("icon1", ResType::MEDIA);
+    EXPECT_TRUE(id > 0);
+    EXPECT_TRUE(rm->Preload(std::vector<uint32_t>()) == nullptr);
+
+    rm->StartPreloadRecord(60000); // 60000 means record for 1min
+    std::unique_ptr<uint8_t[]> outValue;
+    size_t len = 0;
+    EXPECT_EQ(rm->GetMediaDataById(id, len, outValue), SUCCESS);
+    EXPECT_EQ(rm->GetMediaDataById(id, len, outValue), SUCCESS);
+    std::vector<uint32_t> ids = rm->GetPreloadRecord();
+    ASSERT_EQ(ids.size(), static_cast<size_t>(1));
+    EXPECT_EQ(ids[0], static_cast<uint32_t>(id));
+    rm->StartPreloadRecord(0);
+    EXPECT_TRUE(rm->GetPreloadRecord().empty());
+
+    MediaCache::GetInstance().Clear();
+    auto handle = rm->Preload(ids);
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_EQ(handle->Wait(), SUCCESS);
+    EXPECT_EQ(MediaCache::GetInstance().GetStatistics().count, static_cast<size_t>(1));
+
+    ids.push_back(NON_EXIST_ID);
+    handle = rm->Preload(ids);
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_EQ(handle->Wait(), NOT_FOUND);
+}
+
+/*
+ * @tc.name: ResourceManagerPreloadFromHapTest002
+ * @tc.desc: Test that the ids read by Preload are not recorded by StartPreloadRecord
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestHap, ResourceManagerPreloadFromHapTest002, TestSize.Level1)
+{
+    rmc->AddHapResource("zh", nullptr, "CN");
+    int id = rmc->GetResId("icon1", ResType::MEDIA);
+    EXPECT_TRUE(id > 0);
+
+    rm->StartPreloadRecord(60000); // 60000 means record for 1min
+    auto handle = rm->Preload(std::vector<uint32_t>{ static_cast<uint32_t>(id) });
+    ASSERT_TRUE(handle != nullptr);
+    EXPECT_EQ(handle->Wait(), SUCCESS);
+    EXPECT_TRUE(rm->GetPreloadRecord().empty());
+    rm->StartPreloadRecord(0);
+}
 }
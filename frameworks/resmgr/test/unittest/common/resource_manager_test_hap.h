@@ -90,6 +90,10 @@ int ResourceManagerGetDrawableInfoByIdFromHapTest001(void);
 int ResourceManagerGetDrawableInfoByIdFromHapTest002(void);
 int ResourceManagerGetDrawableInfoByNameFromHapTest001(void);
 int ResourceManagerGetDrawableInfoByNameFromHapTest002(void);
+int ResourceManagerGetSharedMediaDataByIdFromHapTest001(void);
+int ResourceManagerGetSharedMediaDataByNameFromHapTest001(void);
+int ResourceManagerPrefetchFromHapTest001(void);
+int ResourceManagerPrefetchFromHapTest002(void);
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
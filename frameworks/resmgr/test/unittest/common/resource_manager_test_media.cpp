@@ -2889,4 +2889,42 @@ HWTEST_F(ResourceManagerTestMedia, ResourceManagerGetDrawableInfoByNameTest001,
     state = rm->GetDrawableInfoByName("icon", info, outValue, 1, density);
     EXPECT_TRUE(state == SUCCESS);
 }
+
+/*
+ * @tc.name: ResourceManagerGetSharedMediaDataByNameTest001
+ * @tc.desc: Test GetSharedMediaDataByName from uncompressed resources, the media file is mapped once
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTestMedia, ResourceManagerGetSharedMediaDataByNameTest001, TestSize.Level1)
+{
+    rmc->AddResource("zh", nullptr, "CN");
+
+    size_t len = 0;
+    std::shared_ptr<const uint8_t[]> outValue;
+    RState state = rm->GetSharedMediaDataByName("icon", len, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_TRUE(outValue != nullptr);
+    EXPECT_GT(len, 0);
+
+    size_t secondLen = 0;
+    std::shared_ptr<const uint8_t[]> secondValue;
+    state = rm->GetSharedMediaDataByName("icon", secondLen, secondValue);
+    ASSERT_EQ(SUCCESS, state);
+    EXPECT_EQ(len, secondLen);
+    EXPECT_EQ(outValue.get(), secondValue.get());
+
+    size_t copyLen = 0;
+    std::unique_ptr<uint8_t[]> copyValue;
+    state = rm->GetMediaDataByName("icon", copyLen, copyValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(len, copyLen);
+    EXPECT_EQ(0, memcmp(outValue.get(), copyValue.get(), len));
+
+    // the released mapping stays valid for the data already handed out
+    std::shared_ptr<HapManager> hapManager = ((ResourceManagerImpl *)rm)->hapManager_;
+    ASSERT_EQ(1, hapManager->mappedFiles_.size());
+    hapManager->ReleaseMappedFiles(hapManager->mappedFiles_.begin()->first);
+    EXPECT_TRUE(hapManager->mappedFiles_.empty());
+    EXPECT_EQ(0, memcmp(outValue.get(), copyValue.get(), len));
+}
 }
@@ -66,6 +66,7 @@ int ResourceManagerGetMediaByNameTest020(void);
 int ResourceManagerGetMediaByNameTest021(void);
 int ResourceManagerGetMediaByNameTest022(void);
 int ResourceManagerGetDrawableInfoByNameTest001(void);
+int ResourceManagerGetSharedMediaDataByNameTest001(void);
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include "utils/utils.h"
+#include "res_locale.h"
 
 using namespace OHOS::Global::Resource;
 using namespace testing::ext;
@@ -198,6 +199,30 @@ HWTEST_F(UtilsTest, TestEncodeRegionByResLocale001, TestSize.Level1)
     EXPECT_EQ(Utils::NULL_REGION, result);
 }
 
+/*
+ * @tc.name: TestEncodeByResLocale002
+ * @tc.desc: Test the encodings computed when ResLocale is built
+ * @tc.type: FUNC
+ */
+HWTEST_F(UtilsTest, TestEncodeByResLocale002, TestSize.Level1)
+{
+    RState state = SUCCESS;
+    ResLocale *locale = ResLocale::BuildFromString("zh-hant-cn", '-', state);
+    ASSERT_TRUE(locale != nullptr);
+    EXPECT_EQ(std::string("Hant"), locale->GetScript());
+    EXPECT_EQ(Utils::EncodeLocale("zh", "Hant", "CN"), locale->GetEncodedLocale());
+    EXPECT_EQ(Utils::EncodeLanguage("zh"), Utils::EncodeLanguageByResLocale(locale));
+    EXPECT_EQ(Utils::EncodeScript("Hant"), Utils::EncodeScriptByResLocale(locale));
+    EXPECT_EQ(Utils::EncodeRegion("CN"), Utils::EncodeRegionByResLocale(locale));
+    delete locale;
+
+    locale = ResLocale::BuildFromParts("en", nullptr, "419", state);
+    ASSERT_TRUE(locale != nullptr);
+    EXPECT_TRUE(locale->GetScript() == nullptr);
+    EXPECT_EQ(Utils::EncodeLocale("en", nullptr, "419"), locale->GetEncodedLocale());
+    delete locale;
+}
+
 /*
  * @tc.name: TestconvertToInteger001
  * @tc.desc: Test convertToInteger function
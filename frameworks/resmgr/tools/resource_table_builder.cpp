@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "system_resource_manager.h"
+
+using namespace OHOS::Global::Resource;
+
+/**
+ * Started once by init at boot, the table cache directory is writable by this process only, so the system resource
+ * caches every app maps can not be forged by an app.
+ */
+int main()
+{
+    return SystemResourceManager::BuildSystemResourceTableCache() ? 0 : 1;
+}
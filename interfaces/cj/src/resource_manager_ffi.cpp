@@ -14,6 +14,7 @@
  */
 
 #include "resource_manager_ffi.h"
+#include <algorithm>
 #include <vector>
 #include "utils.h"
 
@@ -126,14 +127,14 @@ void CopyUI8Arr(RetDataCArrUI8 &ret, std::unique_ptr<uint8_t[]> &data, size_t le
         LOGE("Wrong data size!")
         return;
     }
+    // the array is released by the cangjie side with free, so it can not take over the data directly
     uint8_t* outValue = static_cast<uint8_t*>(malloc(sizeof(uint8_t) * len));
     if (outValue == nullptr) {
         ret.code = RState::ERROR;
         return;
     }
-    for (size_t i = 0; i < len; ++i) {
-        outValue[i] = data[i];
-    }
+    std::copy_n(data.get(), len, outValue);
+    data.reset();
     ret.data.size = static_cast<int64_t>(len);
     ret.data.head = outValue;
 }
@@ -840,6 +841,56 @@ RetDataU32 CJ_GetSymbolByName(int64_t id, const char* name)
     }
     return ret;
 }
+
+int32_t CJ_GetValues(int64_t id, CBatchItem* items, int64_t count, char* arena, int64_t arenaSize,
+    int64_t &requiredSize)
+{
+    LOGI("CJ_GetValues start");
+    // the value types of the batch, same as ResourceManager_ResourceType of the NDK
+    static const ResType batchTypes[] = {
+        ResType::STRING, ResType::COLOR, ResType::FLOAT, ResType::INTEGER, ResType::BOOLEAN
+    };
+    auto instance = FFIData::GetData<ResourceManagerImpl>(id);
+    if (!instance) {
+        LOGE("ResourceManager instance not exist %{public}" PRId64, id);
+        return ERR_INVALID_INSTANCE_CODE;
+    }
+    if (items == nullptr || count < 0) {
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    std::vector<ResourceManager::BatchItem> batchItems(count);
+    for (int64_t i = 0; i < count; i++) {
+        if (items[i].type < 0 || static_cast<size_t>(items[i].type) >= sizeof(batchTypes) / sizeof(batchTypes[0])) {
+            LOGE("CJ_GetValues invalid type %{public}d", items[i].type);
+            return ERROR_CODE_INVALID_INPUT_PARAMETER;
+        }
+        batchItems[i].id = items[i].resId;
+        batchItems[i].type = batchTypes[items[i].type];
+    }
+    std::string stringArena;
+    int32_t state = instance->GetResourcesByIds(batchItems, stringArena);
+    if (state == ERR_INVALID_INSTANCE_CODE) {
+        return state;
+    }
+    requiredSize = static_cast<int64_t>(stringArena.size());
+    if (!stringArena.empty()) {
+        if (arena == nullptr || arenaSize < requiredSize) {
+            LOGE("CJ_GetValues arena too small, required size %{public}" PRId64, requiredSize);
+            return NOT_ENOUGH_MEM;
+        }
+        std::char_traits<char>::copy(arena, stringArena.data(), stringArena.size());
+    }
+    for (int64_t i = 0; i < count; i++) {
+        items[i].code = batchItems[i].state;
+        items[i].colorValue = batchItems[i].colorValue;
+        items[i].intValue = batchItems[i].intValue;
+        items[i].floatValue = batchItems[i].floatValue;
+        items[i].boolValue = batchItems[i].boolValue;
+        items[i].stringOffset = static_cast<int64_t>(batchItems[i].stringOffset);
+        items[i].stringLen = static_cast<int64_t>(batchItems[i].stringLen);
+    }
+    return SUCCESS_CODE;
+}
 }
 }
 }
\ No newline at end of file
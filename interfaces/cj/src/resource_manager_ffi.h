@@ -46,6 +46,28 @@ extern "C" {
         uint32_t data;
     };
 
+    struct CBatchItem {
+        /** the resource id, set by the caller */
+        uint32_t resId;
+
+        /** the value type, set by the caller, 0 string, 1 color, 2 float, 3 int, 4 boolean */
+        int32_t type;
+
+        /** the error code of the item */
+        int32_t code;
+
+        uint32_t colorValue;
+        int32_t intValue;
+        float floatValue;
+        bool boolValue;
+
+        /** the offset of the null terminated string value in the arena */
+        int64_t stringOffset;
+
+        /** the length of the string value */
+        int64_t stringLen;
+    };
+
     FFI_EXPORT int64_t CJ_GetResourceManagerStageMode(OHOS::AbilityRuntime::Context* context);
     FFI_EXPORT RetDataI64 CJ_GetSystemResMgr();
     FFI_EXPORT RetDataI64 FfiGetOverrideResMgr(int64_t id, OHOS::Resource::ConfigurationEx cfg);
@@ -92,6 +114,8 @@ extern "C" {
     FFI_EXPORT RetDataU32 CJ_GetSymbol(int64_t id, uint32_t resId);
     FFI_EXPORT RetDataU32 CJ_GetSymbolByResource(int64_t id, CResource resource);
     FFI_EXPORT RetDataU32 CJ_GetSymbolByName(int64_t id, const char* name);
+    FFI_EXPORT int32_t CJ_GetValues(int64_t id, CBatchItem* items, int64_t count, char* arena, int64_t arenaSize,
+        int64_t &requiredSize);
 }
 
 #endif
\ No newline at end of file
@@ -486,6 +486,16 @@ int32_t ResourceManagerImpl::GetSymbolByName(const char *name, uint32_t &outValu
     return resMgr_->GetSymbolByName(name, outValue);
 }
 
+int32_t ResourceManagerImpl::GetResourcesByIds(std::vector<Global::Resource::ResourceManager::BatchItem> &items,
+    std::string &arena)
+{
+    if (IsEmpty()) {
+        LOGE("Empty resource manager.");
+        return ERR_INVALID_INSTANCE_CODE;
+    }
+    return resMgr_->GetResourcesByIds(items, arena);
+}
+
 std::shared_ptr<ResourceManager> ResourceManagerImpl::GetOverrideResMgr(ConfigurationEx &cfg, int32_t &errCode)
 {
     std::shared_ptr<ResConfig> config(CreateDefaultResConfig());
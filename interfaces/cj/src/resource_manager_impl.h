@@ -112,6 +112,9 @@ public:
     std::shared_ptr<Global::Resource::ResourceManager> GetOverrideResMgr(ConfigurationEx &configuration,
         int32_t &errCode) override;
 
+    int32_t GetResourcesByIds(std::vector<Global::Resource::ResourceManager::BatchItem> &items,
+        std::string &arena) override;
+
     bool GetHapResourceManager(Global::Resource::ResourceManager::Resource resource,
         std::shared_ptr<Global::Resource::ResourceManager> &resMgr, uint32_t &resId);
 
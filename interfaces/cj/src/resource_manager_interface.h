@@ -80,6 +80,8 @@ public:
     virtual int32_t GetSymbolByName(const char *name, uint32_t &outValue) = 0;
     virtual std::shared_ptr<Global::Resource::ResourceManager> GetOverrideResMgr(ConfigurationEx &configuration,
         int32_t &errCode) = 0;
+    virtual int32_t GetResourcesByIds(std::vector<Global::Resource::ResourceManager::BatchItem> &items,
+        std::string &arena) = 0;
 };
 } // namespace Resource
 } // namespace OHOS
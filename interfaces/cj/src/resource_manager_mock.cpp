@@ -57,4 +57,5 @@ FFI_EXPORT int CJ_GetLocales = 0;
 FFI_EXPORT int CJ_GetSymbol = 0;
 FFI_EXPORT int CJ_GetSymbolByResource = 0;
 FFI_EXPORT int CJ_GetSymbolByName = 0;
+FFI_EXPORT int CJ_GetValues = 0;
 }
\ No newline at end of file
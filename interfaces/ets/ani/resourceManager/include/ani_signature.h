@@ -25,6 +25,9 @@ public:
     static constexpr const char *ANI_ARRAY = "std.core.Array";
     static constexpr const char *ANI_STRING = "std.core.String";
     static constexpr const char *ANI_DOUBLE = "std.core.Double";
+    static constexpr const char *ANI_LONG = "std.core.Long";
+    static constexpr const char *ANI_INT = "std.core.Int";
+    static constexpr const char *ANI_BOOLEAN = "std.core.Boolean";
     static constexpr const char *ANI_UINT8ARRAY = "escompat.Uint8Array";
     static constexpr const char *BUSINESSERROR = "@ohos.base.BusinessError";
 
@@ -45,6 +45,10 @@ public:
     static ani_object CreateAniUint8Array(ani_env* env, std::unique_ptr<uint8_t[]> &mediaData, size_t len);
     static ani_object CreateDeviceCapability(ani_env *env, std::unique_ptr<ResConfig> &cfg);
     static ani_object CreateAniRawFileDescriptor(ani_env *env, const ResourceManager::RawFileDescriptor& descriptor);
+    static bool GetBatchItems(ani_env *env, ani_object resIds, ani_object types,
+        std::vector<ResourceManager::BatchItem> &items);
+    static ani_object CreateAniBatchValues(ani_env *env, const std::vector<ResourceManager::BatchItem> &items,
+        const std::string &arena);
 
 private:
     static std::string FindErrMsg(int32_t errCode);
@@ -59,6 +63,8 @@ private:
     static int GetDeviceTypeIndex(DeviceType value);
     static bool GetNumberMember(ani_env *env, ani_object options, const std::string name, int& value);
     static bool GetToDoubleMethod(ani_env *env, ani_class &doubleCls, ani_method &toDoubleMethod);
+    static ani_ref CreateAniBatchValue(ani_env *env, const ResourceManager::BatchItem &item,
+        const std::string &arena);
 };
 } // namespace Resource
 } // namespace Global
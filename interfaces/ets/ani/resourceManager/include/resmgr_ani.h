@@ -110,6 +110,7 @@ public:
     static void UpdateOverrideConfiguration(ani_env* env, ani_object object, ani_object configuration);
 
     static ani_string GetResName(ani_env* env, ani_object object, ani_long resId);
+    static ani_object GetValuesSync(ani_env* env, ani_object object, ani_object resIds, ani_object types);
 
     static ani_object GetSysResourceManager(ani_env* env);
 
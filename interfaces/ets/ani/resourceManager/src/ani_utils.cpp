@@ -15,6 +15,7 @@
 
 #include "ani_utils.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -463,8 +464,20 @@ ani_object AniUtils::CreateAniArray(ani_env *env, const std::vector<std::string>
 
 ani_object AniUtils::CreateAniUint8Array(ani_env* env, std::unique_ptr<uint8_t[]> &mediaData, size_t len)
 {
+    void *data = nullptr;
+    ani_arraybuffer buffer;
+    ani_status status = env->CreateArrayBuffer(len, &data, &buffer);
+    if (ANI_OK != status) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "Create array buffer failed, status: %{public}d.", status);
+        return nullptr;
+    }
+    if (len > 0 && mediaData != nullptr) {
+        std::copy_n(mediaData.get(), len, static_cast<uint8_t*>(data));
+    }
+    mediaData.reset();
+
     ani_class cls;
-    ani_status status = env->FindClass(AniSignature::ANI_UINT8ARRAY, &cls);
+    status = env->FindClass(AniSignature::ANI_UINT8ARRAY, &cls);
     if (ANI_OK != status) {
         RESMGR_HILOGE(RESMGR_ANI_TAG, "Find class %{public}s failed, status: %{public}d",
             AniSignature::ANI_UINT8ARRAY, status);
@@ -472,36 +485,22 @@ ani_object AniUtils::CreateAniUint8Array(ani_env* env, std::unique_ptr<uint8_t[]
     }
 
     ani_method ctor;
-    status = env->Class_FindMethod(cls, "<ctor>", "i:", &ctor);
+    status = env->Class_FindMethod(cls, "<ctor>", "C{escompat.ArrayBuffer}C{std.core.Int}C{std.core.Int}:", &ctor);
     if (ANI_OK != status) {
         RESMGR_HILOGE(RESMGR_ANI_TAG, "Find method <ctor> in %{public}s failed, status: %{public}d.",
             AniSignature::ANI_UINT8ARRAY, status);
         return nullptr;
     }
 
+    ani_ref undefined;
+    env->GetUndefined(&undefined);
     ani_object ret;
-    status = env->Object_New(cls, ctor, &ret, len);
+    status = env->Object_New(cls, ctor, &ret, buffer, undefined, undefined);
     if (ANI_OK != status) {
         RESMGR_HILOGE(RESMGR_ANI_TAG, "New object %{public}s failed, status: %{public}d",
             AniSignature::ANI_UINT8ARRAY, status);
         return nullptr;
     }
-
-    ani_method set;
-    status = env->Class_FindMethod(cls, "$_set", "ii:", &set);
-    if (ANI_OK != status) {
-        RESMGR_HILOGE(RESMGR_ANI_TAG, "Find method 'set' in %{public}s failed, status :%{public}d.",
-            AniSignature::ANI_UINT8ARRAY, status);
-        return nullptr;
-    }
-
-    for (size_t i = 0; i < len; i++) {
-        if (ANI_OK != env->Object_CallMethod_Void(ret, set, i, mediaData[i])) {
-            RESMGR_HILOGE(RESMGR_ANI_TAG, "Call method 'set' in %{public}s failed, status :%{public}d.",
-                AniSignature::ANI_UINT8ARRAY, status);
-            return nullptr;
-        }
-    }
     return ret;
 }
 
@@ -598,6 +597,130 @@ bool AniUtils::GetToDoubleMethod(ani_env *env, ani_class &doubleCls, ani_method
     return true;
 }
 
+bool AniUtils::GetBatchItems(ani_env *env, ani_object resIds, ani_object types,
+    std::vector<ResourceManager::BatchItem> &items)
+{
+    // the value types of the batch, same as ResourceManager_ResourceType of the NDK
+    static const ResType batchTypes[] = {
+        ResType::STRING, ResType::COLOR, ResType::FLOAT, ResType::INTEGER, ResType::BOOLEAN
+    };
+    ani_size idCount = 0;
+    ani_size typeCount = 0;
+    if (ANI_OK != env->Array_GetLength(static_cast<ani_array>(resIds), &idCount)
+        || ANI_OK != env->Array_GetLength(static_cast<ani_array>(types), &typeCount) || idCount != typeCount) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "Get batch array length failed or mismatch.");
+        return false;
+    }
+    ani_class longClass;
+    ani_method toLongMethod;
+    ani_class intClass;
+    ani_method toIntMethod;
+    if (ANI_OK != env->FindClass(AniSignature::ANI_LONG, &longClass)
+        || ANI_OK != env->Class_FindMethod(longClass, "toLong", ":l", &toLongMethod)
+        || ANI_OK != env->FindClass(AniSignature::ANI_INT, &intClass)
+        || ANI_OK != env->Class_FindMethod(intClass, "toInt", ":i", &toIntMethod)) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "Find method toLong or toInt failed.");
+        return false;
+    }
+    items.resize(idCount);
+    for (ani_size i = 0; i < idCount; ++i) {
+        ani_ref id;
+        ani_ref type;
+        ani_long idValue;
+        ani_int typeValue;
+        if (ANI_OK != env->Array_Get(static_cast<ani_array>(resIds), i, &id)
+            || ANI_OK != env->Object_CallMethod_Long(static_cast<ani_object>(id), toLongMethod, &idValue)
+            || ANI_OK != env->Array_Get(static_cast<ani_array>(types), i, &type)
+            || ANI_OK != env->Object_CallMethod_Int(static_cast<ani_object>(type), toIntMethod, &typeValue)
+            || typeValue < 0 || static_cast<size_t>(typeValue) >= sizeof(batchTypes) / sizeof(batchTypes[0])) {
+            RESMGR_HILOGE(RESMGR_ANI_TAG, "Invalid batch item, index: %{public}zu.", static_cast<size_t>(i));
+            return false;
+        }
+        items[i].id = static_cast<uint32_t>(idValue);
+        items[i].type = batchTypes[typeValue];
+    }
+    return true;
+}
+
+ani_ref AniUtils::CreateAniBatchValue(ani_env *env, const ResourceManager::BatchItem &item,
+    const std::string &arena)
+{
+    ani_ref value = nullptr;
+    if (item.state != SUCCESS) {
+        env->GetUndefined(&value);
+        return value;
+    }
+    if (item.type == ResType::STRING) {
+        ani_string str = nullptr;
+        env->String_NewUTF8(arena.data() + item.stringOffset, item.stringLen, &str);
+        return str;
+    }
+    const char *className = AniSignature::ANI_LONG;
+    const char *signature = "l:";
+    if (item.type == ResType::FLOAT) {
+        className = AniSignature::ANI_DOUBLE;
+        signature = "d:";
+    } else if (item.type == ResType::BOOLEAN) {
+        className = AniSignature::ANI_BOOLEAN;
+        signature = "z:";
+    }
+    ani_class cls;
+    ani_method ctor;
+    if (ANI_OK != env->FindClass(className, &cls) || ANI_OK != env->Class_FindMethod(cls, "<ctor>", signature, &ctor)) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "Find <ctor> of %{public}s failed.", className);
+        return nullptr;
+    }
+    ani_object obj = nullptr;
+    ani_status status = ANI_OK;
+    if (item.type == ResType::FLOAT) {
+        status = env->Object_New(cls, ctor, &obj, static_cast<ani_double>(item.floatValue));
+    } else if (item.type == ResType::BOOLEAN) {
+        status = env->Object_New(cls, ctor, &obj, static_cast<ani_boolean>(item.boolValue));
+    } else if (item.type == ResType::COLOR) {
+        status = env->Object_New(cls, ctor, &obj, static_cast<ani_long>(item.colorValue));
+    } else {
+        status = env->Object_New(cls, ctor, &obj, static_cast<ani_long>(item.intValue));
+    }
+    if (ANI_OK != status) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "New object %{public}s failed, status: %{public}d.", className, status);
+        return nullptr;
+    }
+    return obj;
+}
+
+ani_object AniUtils::CreateAniBatchValues(ani_env *env, const std::vector<ResourceManager::BatchItem> &items,
+    const std::string &arena)
+{
+    ani_class cls;
+    ani_method ctor;
+    ani_method set;
+    if (ANI_OK != env->FindClass(AniSignature::ANI_ARRAY, &cls)
+        || ANI_OK != env->Class_FindMethod(cls, "<ctor>", "i:", &ctor)
+        || ANI_OK != env->Class_FindMethod(cls, "$_set", "iY:", &set)) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "Find method of %{public}s failed.", AniSignature::ANI_ARRAY);
+        return nullptr;
+    }
+    ani_object ret;
+    ani_status status = env->Object_New(cls, ctor, &ret, items.size());
+    if (ANI_OK != status) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "New object %{public}s failed, status: %{public}d",
+            AniSignature::ANI_ARRAY, status);
+        return nullptr;
+    }
+    for (size_t i = 0; i < items.size(); i++) {
+        ani_ref value = CreateAniBatchValue(env, items[i], arena);
+        if (value == nullptr) {
+            return nullptr;
+        }
+        status = env->Object_CallMethod_Void(ret, set, i, value);
+        if (ANI_OK != status) {
+            RESMGR_HILOGE(RESMGR_ANI_TAG, "Call method '$_set' failed, status :%{public}d.", status);
+            return nullptr;
+        }
+    }
+    return ret;
+}
+
 ani_object AniUtils::CreateDeviceCapability(ani_env *env, std::unique_ptr<ResConfig> &cfg)
 {
     ani_class cls;
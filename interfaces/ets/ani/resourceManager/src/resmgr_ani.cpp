@@ -131,6 +131,7 @@ static std::array methods = {
         reinterpret_cast<void*>(ResMgrAni::UpdateOverrideConfiguration) },
 
     ani_native_function { "getResourceName", nullptr, reinterpret_cast<void*>(ResMgrAni::GetResName) },
+    ani_native_function { "getValuesSync", nullptr, reinterpret_cast<void*>(ResMgrAni::GetValuesSync) },
 };
 
 ani_string ResMgrAni::GetStringSyncById(ani_env* env, ani_object object, ani_long resId)
@@ -1066,6 +1067,24 @@ ani_string ResMgrAni::GetResName(ani_env *env, ani_object object, ani_long resId
     return AniUtils::CreateAniString(env, result);
 }
 
+ani_object ResMgrAni::GetValuesSync(ani_env* env, ani_object object, ani_object resIds, ani_object types)
+{
+    std::shared_ptr<ResourceManager> resMgr = AniUtils::GetResourceManager(env, object);
+    if (resMgr == nullptr) {
+        RESMGR_HILOGE(RESMGR_ANI_TAG, "Failed to get resMgr in GetValuesSync.");
+        AniUtils::AniThrow(env, ERROR_CODE_RES_ID_NOT_FOUND);
+        return nullptr;
+    }
+    std::vector<ResourceManager::BatchItem> items;
+    if (!AniUtils::GetBatchItems(env, resIds, types, items)) {
+        AniUtils::AniThrow(env, ERROR_CODE_INVALID_INPUT_PARAMETER);
+        return nullptr;
+    }
+    std::string arena;
+    resMgr->GetResourcesByIds(items, arena);
+    return AniUtils::CreateAniBatchValues(env, items, arena);
+}
+
 ani_object ResMgrAni::GetSysResourceManager(ani_env* env)
 {
     std::shared_ptr<Global::Resource::ResourceManager> sysResMgr(SystemResourceManager::CreateSysResourceManager());
@@ -120,6 +120,17 @@ static const uint32_t SELECT_PATTERN = 0x0800;
 static const uint32_t SELECT_SYMBOL = 0x1000;
 static const uint32_t SELECT_ALL = 0xFFFFFFFF;
 
+// the fields of the resource config changed by an update
+static const uint32_t CONFIG_CHANGE_NONE = 0x0000;
+static const uint32_t CONFIG_CHANGE_LOCALE = 0x0001;
+static const uint32_t CONFIG_CHANGE_COLOR_MODE = 0x0002;
+static const uint32_t CONFIG_CHANGE_DIRECTION = 0x0004;
+static const uint32_t CONFIG_CHANGE_DENSITY = 0x0008;
+static const uint32_t CONFIG_CHANGE_DEVICE_TYPE = 0x0010;
+static const uint32_t CONFIG_CHANGE_MCC_MNC = 0x0020;
+static const uint32_t CONFIG_CHANGE_INPUT_DEVICE = 0x0040;
+static const uint32_t CONFIG_CHANGE_THEME = 0x0080;
+
 enum DeviceType : int32_t {
     DEVICE_NOT_SET  = -1,
     DEVICE_PHONE    = 0,
@@ -81,6 +81,91 @@ public:
         NAPI_STRING = 1
     };
 
+    struct PrefetchRequest {
+        /** the media resource ids to prefetch */
+        std::vector<uint32_t> ids;
+
+        /** the media resource names to prefetch */
+        std::vector<std::string> names;
+
+        /** the rawfile paths to prefetch */
+        std::vector<std::string> rawFiles;
+
+        /** the screen density of the media, 0 means the density of current config */
+        uint32_t density = 0;
+    };
+
+    class PrefetchHandle {
+    public:
+        virtual ~PrefetchHandle() = default;
+
+        /**
+         * Block until the prefetch is finished or cancelled.
+         *
+         * @return SUCCESS if all resources are prefetched, ERROR if cancelled, else NOT_FOUND
+         */
+        virtual RState Wait() = 0;
+
+        /**
+         * Block until the prefetch is finished or cancelled, or the timeout expires.
+         *
+         * @param timeoutMs the timeout in milliseconds
+         * @return true if the prefetch is finished or cancelled, false if timeout
+         */
+        virtual bool WaitFor(uint32_t timeoutMs) = 0;
+
+        /**
+         * Cancel the prefetch, the resources not read yet are skipped.
+         */
+        virtual void Cancel() = 0;
+
+        /**
+         * Whether the prefetch is finished or cancelled.
+         *
+         * @return true if finished, else false
+         */
+        virtual bool IsFinished() = 0;
+    };
+
+    /**
+     * The pre-resolved resource of an id or a name, created by GetResourceHandle or GetResourceHandleByName.
+     * The handle stays valid across AddResource and RemoveResource, and the getters by handle fail with
+     * the same error codes as the getters by id once the resource is removed.
+     */
+    class ResourceHandle {
+    public:
+        virtual ~ResourceHandle() = default;
+    };
+
+    struct BatchItem {
+        /** the resource id, set by the caller */
+        uint32_t id = 0;
+
+        /** the resource type, set by the caller, STRING, COLOR, FLOAT, INTEGER and BOOLEAN are supported */
+        ResType type = ResType::STRING;
+
+        /** the lookup state of the resource, same as the single getter by id */
+        RState state = NOT_FOUND;
+
+        /** the COLOR value */
+        uint32_t colorValue = 0;
+
+        /** the INTEGER value */
+        int intValue = 0;
+
+        /** the FLOAT value, recalculated by the unit and the screen density */
+        float floatValue = 0.0f;
+
+        /** the BOOLEAN value */
+        bool boolValue = false;
+
+        /** the offset of the null terminated STRING value in the arena */
+        size_t stringOffset = 0;
+
+        /** the length of the STRING value, not including the terminating null */
+        size_t stringLen = 0;
+    };
+
     virtual ~ResourceManager() = 0;
 
     /**
@@ -291,6 +376,167 @@ public:
         std::vector<std::tuple<ResourceManager::NapiValueType, std::string>> &jsParams) = 0;
 
     virtual RState GetResName(uint32_t id, std::string &outValue) = 0;
+
+    /**
+     * Get the MEDIA data by resource id without copying it out of the media cache
+     * @param id the resource id
+     * @param len the data len write to
+     * @param outValue the shared media data write to, it must not be modified. The buffer stays valid as long as
+     *      outValue holds it, even after the cache evicts it or the resource is removed
+     * @param density the screen density, within the area of OHOS::Global::Resource::ScreenDensity, 0 means the
+     *      density of current config
+     * @return SUCCESS if resource exist, ERROR_CODE_INVALID_INPUT_PARAMETER if the density is invalid,
+     *      ERROR_CODE_RES_ID_NOT_FOUND if the id is not found, else ERROR_CODE_RES_NOT_FOUND_BY_ID
+     */
+    virtual RState GetSharedMediaDataById(uint32_t id, size_t &len, std::shared_ptr<const uint8_t[]> &outValue,
+        uint32_t density = 0) = 0;
+
+    /**
+     * Get the MEDIA data by resource name without copying it out of the media cache
+     * @param name the resource name
+     * @param len the data len write to
+     * @param outValue the shared media data write to, it must not be modified. The buffer stays valid as long as
+     *      outValue holds it, even after the cache evicts it or the resource is removed
+     * @param density the screen density, within the area of OHOS::Global::Resource::ScreenDensity, 0 means the
+     *      density of current config
+     * @return SUCCESS if resource exist, ERROR_CODE_INVALID_INPUT_PARAMETER if the density is invalid,
+     *      ERROR_CODE_RES_NAME_NOT_FOUND if the name is not found, else ERROR_CODE_RES_NOT_FOUND_BY_NAME
+     */
+    virtual RState GetSharedMediaDataByName(const char *name, size_t &len,
+        std::shared_ptr<const uint8_t[]> &outValue, uint32_t density = 0) = 0;
+
+    /**
+     * Read the media and rawfile resources into the media cache in background, so that the later
+     * GetMedia and GetRawFile calls are served from memory.
+     *
+     * @param request the resources to prefetch
+     * @return the handle to wait or cancel the prefetch, nullptr if nothing to prefetch
+     */
+    virtual std::shared_ptr<PrefetchHandle> Prefetch(const PrefetchRequest &request) = 0;
+
+    /**
+     * Resolve the hot resources in background, called right after the resources are added, so that their first
+     * accesses on the UI thread do not parse the resource index. The qualifiers of each id are parsed, the best
+     * match for the current config is selected and the media are read into the media cache.
+     *
+     * @param ids the hot resource ids, for example the ids recorded by StartPreloadRecord on a previous start
+     * @return the handle to wait or cancel the preload, nullptr if nothing to preload
+     */
+    virtual std::shared_ptr<PrefetchHandle> Preload(const std::vector<uint32_t> &ids) = 0;
+
+    /**
+     * Record the resource ids looked up by id from now on until the window expires, the ids recorded before
+     * are cleared.
+     *
+     * @param durationMs the recording window in milliseconds, 0 to stop recording
+     */
+    virtual void StartPreloadRecord(uint32_t durationMs) = 0;
+
+    /**
+     * Get the resource ids recorded since StartPreloadRecord, which is the hot list to pass to Preload.
+     *
+     * @return the ids in the order they were first accessed
+     */
+    virtual std::vector<uint32_t> GetPreloadRecord() = 0;
+
+    /**
+     * Get a batch of resources by id, all of them are resolved under one snapshot of the config
+     * and the resource list.
+     *
+     * @param items the ids and types to get, the state and value of each item are written back
+     * @param arena the STRING values are appended to, each is null terminated
+     * @return SUCCESS if all the items are found, else NOT_FOUND, the state of each item tells the detail
+     */
+    virtual RState GetResourcesByIds(std::vector<BatchItem> &items, std::string &arena) = 0;
+
+    /**
+     * Create the handle of the resource id, the later lookups by the handle skip the resource maps
+     * and only select the best resource again after the config is changed.
+     *
+     * @param id the resource id
+     * @return the resource handle, nullptr if the resource id is not found
+     */
+    virtual std::shared_ptr<ResourceHandle> GetResourceHandle(uint32_t id) = 0;
+
+    /**
+     * Create the handle of the resource name.
+     *
+     * @param name the resource name
+     * @param type the resource type
+     * @return the resource handle, nullptr if the resource name is not found
+     */
+    virtual std::shared_ptr<ResourceHandle> GetResourceHandleByName(const char *name, ResType type) = 0;
+
+    /**
+     * Get the string resource by the handle. The handle must be created by GetResourceHandle or
+     * GetResourceHandleByName of this resource manager. It stays valid across UpdateResConfig, the best
+     * resource is selected again on the first lookup after the config is changed, and across AddResource
+     * and RemoveResource, the lookup fails once the resource is removed.
+     *
+     * @param handle the resource handle
+     * @param outValue the obtain value filled to
+     * @return SUCCESS if resource exist,
+     *     ERROR_CODE_INVALID_INPUT_PARAMETER if the handle is null or belongs to other resource manager,
+     *     ERROR_CODE_RES_ID_NOT_FOUND or ERROR_CODE_RES_NAME_NOT_FOUND if the resource is removed,
+     *     ERROR_CODE_RES_NOT_FOUND_BY_ID or ERROR_CODE_RES_NOT_FOUND_BY_NAME if the resource is not a string,
+     *     ERROR_CODE_RES_REF_TOO_MUCH if the resource references too many levels
+     */
+    virtual RState GetStringByHandle(const std::shared_ptr<ResourceHandle> &handle, std::string &outValue) = 0;
+
+    /**
+     * Get the color resource by the handle, the color of the theme pack is returned first. The handle
+     * follows the same rules as GetStringByHandle.
+     *
+     * @param handle the resource handle
+     * @param outValue the obtain value filled to
+     * @return SUCCESS if resource exist, else the same error codes as GetStringByHandle
+     */
+    virtual RState GetColorByHandle(const std::shared_ptr<ResourceHandle> &handle, uint32_t &outValue) = 0;
+
+    /**
+     * Get the generation of the resources, it changes whenever the config is changed or the haps or the overlays
+     * are added or removed, so the values cached by the caller are valid as long as it is unchanged.
+     *
+     * @return the resource generation
+     */
+    virtual uint64_t GetResourceGeneration() = 0;
+
+    /**
+     * Get the generation of the config, it changes whenever a field of the config or the override config is
+     * changed, so the config got by GetResConfig is unchanged as long as it is unchanged.
+     *
+     * @return the config generation
+     */
+    virtual uint64_t GetConfigGeneration() = 0;
+
+    /**
+     * Get the fields changed by the latest update of the config or the override config, so a cache built at the
+     * previous config generation only drops the values that depend on these fields.
+     *
+     * @return the mask of CONFIG_CHANGE_* flags
+     */
+    virtual uint32_t GetLastConfigChanges() = 0;
+
+    /**
+     * Get the INTARRAY resource by id as a contiguous int32 buffer. The array is resolved once per resource
+     * generation and the same buffer is shared by the later calls, it must not be modified.
+     *
+     * @param id the resource id
+     * @param outValue the shared int array write to
+     * @return SUCCESS if resource exist, else not found
+     */
+    virtual RState GetSharedIntArrayById(uint32_t id, std::shared_ptr<const std::vector<int32_t>> &outValue) = 0;
+
+    /**
+     * Get the INTARRAY resource by name as a contiguous int32 buffer, shared the same way as
+     * GetSharedIntArrayById, it must not be modified.
+     *
+     * @param name the resource name
+     * @param outValue the shared int array write to
+     * @return SUCCESS if resource exist, else not found
+     */
+    virtual RState GetSharedIntArrayByName(const char *name,
+        std::shared_ptr<const std::vector<int32_t>> &outValue) = 0;
 };
 
 EXPORT_FUNC ResourceManager *CreateResourceManager(bool includeSystemRes = true);
@@ -21,6 +21,8 @@
 #else
 #include "context.h"
 #endif
+#include <mutex>
+
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 #include "resource_manager.h"
@@ -86,6 +88,14 @@ public:
         return isOverrideAddon_;
     }
 
+    /**
+     * Get the config of the resource manager. It is read again only when the config generation changes, so the
+     * config getters build a new js object on each call without reading the config from the resource manager.
+     *
+     * @return the config shared by the callers which must not be modified, nullptr if it failed to be read
+     */
+    std::shared_ptr<ResConfig> GetResConfigSnapshot();
+
 private:
     static napi_value AddonGetResource(napi_env env, napi_callback_info info, const std::string& name,
         FunctionType type);
@@ -229,6 +239,22 @@ private:
 
     static napi_value GetResName(napi_env env, napi_callback_info info);
 
+    static napi_value GetValuesSync(napi_env env, napi_callback_info info);
+
+    static napi_value GetIntArrayValueSync(napi_env env, napi_callback_info info);
+
+    static napi_value GetIntArrayByNameSync(napi_env env, napi_callback_info info);
+
+    static napi_value GetConfigGenerationSync(napi_env env, napi_callback_info info);
+
+    static napi_value SetStringCacheEnabledSync(napi_env env, napi_callback_info info);
+
+    static napi_value GetSendableResourceManager(napi_env env, napi_callback_info info);
+
+    static napi_value WrapSendableResourceManager(napi_env env, std::shared_ptr<ResourceManagerAddon> &addon);
+
+    static napi_value GetSendableConstructor(napi_env env);
+
     static bool AddConstructorRef(napi_env env, napi_ref ref);
 
     static napi_ref GetConstructorRef(napi_env env);
@@ -239,7 +265,11 @@ private:
     bool isSystem_;
     std::shared_ptr<ResourceManagerNapiContext> napiContext_;
     static napi_property_descriptor properties[];
+    static napi_property_descriptor sendableProperties[];
     bool isOverrideAddon_ = false;
+    std::mutex configMutex_;
+    uint64_t configGeneration_ = 0;
+    std::shared_ptr<ResConfig> configSnapshot_;
 };
 } // namespace Resource
 } // namespace Global
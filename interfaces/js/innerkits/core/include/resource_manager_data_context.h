@@ -23,8 +23,6 @@ namespace OHOS {
 namespace Global {
 namespace Resource {
 struct ResMgrDataContext {
-    napi_async_work work_;
-
     std::string bundleName_;
     uint32_t resId_;
     int32_t param_;
@@ -39,6 +37,7 @@ struct ResMgrDataContext {
 
     typedef napi_value (*CreateNapiValue)(napi_env env, ResMgrDataContext &context);
     CreateNapiValue createValueFunc_;
+    napi_async_execute_callback execute_;
     std::string value_;
     std::vector<std::string> arrayValue_;
     std::vector<std::tuple<ResourceManager::NapiValueType, std::string>> jsParams_;
@@ -61,10 +60,11 @@ struct ResMgrDataContext {
     std::shared_ptr<ResourceManager> resMgr_;
     std::shared_ptr<ResourceManager::Resource> resource_;
     std::shared_ptr<ResConfig> overrideResConfig_;
+    bool isConfigDependent_ = true;
 
-    ResMgrDataContext() : work_(nullptr), resId_(0), param_(0), iValue_(0), fValue_(0.0f), bValue_(false),
-        colorValue_(0), createValueFunc_(nullptr), len_(0), deferred_(nullptr), callbackRef_(nullptr), success_(true),
-        errCode_(0), density_(0), iconType_(0), symbolValue_(0) {}
+    ResMgrDataContext() : resId_(0), param_(0), iValue_(0), fValue_(0.0f), bValue_(false),
+        colorValue_(0), createValueFunc_(nullptr), execute_(nullptr), len_(0), deferred_(nullptr),
+        callbackRef_(nullptr), success_(true), errCode_(0), density_(0), iconType_(0), symbolValue_(0) {}
 
     void Release(napi_env env)
     {
@@ -72,10 +72,24 @@ struct ResMgrDataContext {
             napi_delete_reference(env, callbackRef_);
             callbackRef_ = nullptr;
         }
-        if (work_ != nullptr) {
-            napi_delete_async_work(env, work_);
-            work_ = nullptr;
-        }
+    }
+
+    // clear the result of the request before it is executed again
+    void ResetResult()
+    {
+        iValue_ = 0;
+        fValue_ = 0.0f;
+        bValue_ = false;
+        colorValue_ = 0;
+        symbolValue_ = 0;
+        value_.clear();
+        arrayValue_.clear();
+        mediaData.reset();
+        len_ = 0;
+        createValueFunc_ = nullptr;
+        errMsg_.clear();
+        success_ = true;
+        errCode_ = 0;
     }
 
     void SetErrorMsg(const std::string &msg, bool withResId = false, int32_t errCode = 0)
@@ -96,8 +110,17 @@ struct ResMgrDataContext {
     {
         GET_PARAMS(env, info, 2); // 2 means get two params
 
+        return UnwrapAddon(env, thisVar);
+    }
+
+    static std::shared_ptr<ResourceManagerAddon> UnwrapAddon(napi_env env, napi_value thisVar)
+    {
         std::shared_ptr<ResourceManagerAddon> *addonPtr = nullptr;
         napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&addonPtr));
+        if (status != napi_ok) {
+            // the sendable resource manager shared with the workers
+            status = napi_unwrap_sendable(env, thisVar, reinterpret_cast<void **>(&addonPtr));
+        }
         if (status != napi_ok) {
             RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to unwrap");
             return nullptr;
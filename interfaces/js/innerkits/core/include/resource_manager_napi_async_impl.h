@@ -16,6 +16,9 @@
 #ifndef RESOURCE_MANAGER_NAPI_ASYNC_IMPL_H
 #define RESOURCE_MANAGER_NAPI_ASYNC_IMPL_H
 
+#include <mutex>
+#include <vector>
+
 #include "resource_manager_napi_base.h"
 #include "resource_manager_data_context.h"
 namespace OHOS {
@@ -36,15 +39,6 @@ public:
      */
     virtual napi_value GetResource(napi_env env, napi_callback_info info, const std::string &functionName) override;
 
-    /**
-     * Complete asynchronous function, pass the data to application.
-     *
-     * @param env The environment that the API is invoked under.
-     * @param status The result status of napi function.
-     * @param data The callback data passed into function
-     */
-    static void Complete(napi_env env, napi_status status, void* data);
-
 private:
 
     static std::unordered_map<std::string, std::function<napi_value(napi_env&, napi_callback_info&)>> asyncFuncMatch;
@@ -121,6 +115,48 @@ private:
 
     static napi_value GetResult(napi_env env, std::unique_ptr<ResMgrDataContext> &dataContext,
         const std::string &name, napi_async_execute_callback &execute);
+
+    /**
+     * The requests issued on the js thread before the worker picks up the pending batch share one async work,
+     * they are executed together on the worker and settled in a single completion pass. A batch is closed once
+     * its cost reaches MAX_BATCH_COST, the following requests go to a new work which may run on another worker.
+     * The requests of the same resource manager in a batch are resolved against one config.
+     */
+    struct AsyncBatch {
+        napi_async_work work = nullptr;
+        bool isStarted = false;
+        size_t cost = 0;
+        std::vector<ResMgrDataContext*> dataContexts;
+    };
+
+    static size_t GetRequestCost(const std::string &name);
+
+    static bool IsConfigDependent(const std::string &name);
+
+    static bool AddToPendingBatch(napi_env env, std::unique_ptr<ResMgrDataContext> &dataContext,
+        const std::string &name);
+
+    static void ExecuteBatch(napi_env env, void* data);
+
+    static void ExecuteGroup(napi_env env, const std::vector<ResMgrDataContext*> &group);
+
+    static void CompleteBatch(napi_env env, napi_status status, void* data);
+
+    static void SettleResult(napi_env env, ResMgrDataContext* dataContext);
+
+    static std::mutex batchMutex_;
+
+    static std::unordered_map<napi_env, AsyncBatch*> pendingBatches_;
+
+    static constexpr size_t MAX_BATCH_COST = 16;
+
+    // a request copying a whole media or raw file fills a batch on its own
+    static constexpr size_t HEAVY_REQUEST_COST = MAX_BATCH_COST;
+
+    static constexpr size_t LIGHT_REQUEST_COST = 1;
+
+    // the times a group is executed again when the config keeps changing under it
+    static constexpr int MAX_CONFIG_RETRY = 3;
 };
 } // namespace Resource
 } // namespace Global
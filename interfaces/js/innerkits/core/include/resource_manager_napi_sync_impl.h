@@ -36,6 +36,51 @@ public:
      */
     virtual napi_value GetResource(napi_env env, napi_callback_info info, const std::string &functionName) override;
 
+    /**
+     * The cheap sync getters are bound by the addon directly instead of going through the function map.
+     * When the resource is given by id, they read it without allocating the data context.
+     *
+     * @param env The environment that the API is invoked under.
+     * @param info The additional information about the context in which the callback was invoked.
+     * @return The resource if resource exist, else errcode and errmessage.
+     */
+    static napi_value GetColorSync(napi_env env, napi_callback_info info);
+
+    static napi_value GetNumber(napi_env env, napi_callback_info info);
+
+    static napi_value GetBoolean(napi_env env, napi_callback_info info);
+
+    /**
+     * Get the int array resource as an Int32Array, the array is resolved once per resource generation.
+     *
+     * @param env The environment that the API is invoked under.
+     * @param info The additional information about the context in which the callback was invoked.
+     * @return The Int32Array if resource exist, else errcode and errmessage.
+     */
+    static napi_value GetIntArrayValueSync(napi_env env, napi_callback_info info);
+
+    static napi_value GetIntArrayByNameSync(napi_env env, napi_callback_info info);
+
+    /**
+     * Get the config generation, the values of the objects returned by getConfigurationSync and
+     * getDeviceCapabilitySync are unchanged as long as it is unchanged.
+     *
+     * @param env The environment that the API is invoked under.
+     * @param info The additional information about the context in which the callback was invoked.
+     * @return The config generation.
+     */
+    static napi_value GetConfigGenerationSync(napi_env env, napi_callback_info info);
+
+    /**
+     * Enable or disable the cache of the js strings returned by getStringSync in the current env,
+     * the cache is disabled by default.
+     *
+     * @param env The environment that the API is invoked under.
+     * @param info The additional information about the context in which the callback was invoked.
+     * @return undefined.
+     */
+    static napi_value SetStringCacheEnabledSync(napi_env env, napi_callback_info info);
+
 private:
 
     static std::unordered_map<std::string, std::function<napi_value(napi_env&, napi_callback_info&)>> syncFuncMatch;
@@ -44,20 +89,14 @@ private:
 
     static napi_value GetStringByNameSync(napi_env env, napi_callback_info info);
 
-    static napi_value GetBoolean(napi_env env, napi_callback_info info);
-
     static napi_value GetBooleanByName(napi_env env, napi_callback_info info);
 
-    static napi_value GetNumber(napi_env env, napi_callback_info info);
-
     static napi_value GetNumberByName(napi_env env, napi_callback_info info);
 
     static napi_value GetDrawableDescriptor(napi_env env, napi_callback_info info);
 
     static napi_value GetDrawableDescriptorByName(napi_env env, napi_callback_info info);
 
-    static napi_value GetColorSync(napi_env env, napi_callback_info info);
-
     static napi_value GetColorByNameSync(napi_env env, napi_callback_info info);
 
     static napi_value AddResource(napi_env env, napi_callback_info info);
@@ -116,9 +155,23 @@ private:
 
     static napi_value GetResName(napi_env env, napi_callback_info info);
 
+    static napi_value GetValuesSync(napi_env env, napi_callback_info info);
+
+    static int32_t InitBatchItems(napi_env env, size_t argc, napi_value *argv,
+        std::vector<ResourceManager::BatchItem> &items);
+
+    static napi_value CreateJsBatchValues(napi_env env, const std::vector<ResourceManager::BatchItem> &items,
+        const std::string &arena);
+
     static int32_t InitIdResourceAddon(napi_env env, napi_callback_info info,
         std::unique_ptr<ResMgrDataContext> &dataContext);
 
+    static bool GetResMgrById(napi_env env, napi_value thisVar, size_t argc, napi_value *argv,
+        std::shared_ptr<ResourceManager> &resMgr, uint32_t &resId);
+
+    static napi_value GetCachedStringById(napi_env env, const std::shared_ptr<ResourceManager> &resMgr,
+        uint32_t resId);
+
     static int32_t InitNameAddon(napi_env env, napi_callback_info info,
         std::unique_ptr<ResMgrDataContext> &dataContext);
 
@@ -30,6 +30,8 @@ public:
 
     static napi_value CreateJsUint8Array(napi_env env, ResMgrDataContext &context);
 
+    static napi_value CreateJsInt32Array(napi_env env, const std::vector<int32_t> &value);
+
     static napi_value CreateJsRawFd(napi_env env, ResMgrDataContext &context);
 
     static napi_value CloseJsRawFd(napi_env env, ResMgrDataContext& context);
@@ -86,9 +88,9 @@ private:
     static bool GetResourceObjectName(napi_env env, std::shared_ptr<ResourceManager::Resource> &resourcePtr,
         napi_value &value, int32_t type);
 
-    static std::string GetLocale(std::unique_ptr<ResConfig> &cfg);
+    static std::string GetLocale(const ResConfig &cfg);
 
-    static napi_value CreateConfig(napi_env env, ResMgrDataContext& context, std::unique_ptr<ResConfig> &cfg);
+    static napi_value CreateConfig(napi_env env, ResMgrDataContext& context, const ResConfig &cfg);
 
     static bool SetIntProperty(napi_env env, ResMgrDataContext& context,
         napi_value &object, const std::string &property, const int &value);
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025-2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RESOURCE_MANAGER_NAPI_VALUE_CACHE_H
+#define RESOURCE_MANAGER_NAPI_VALUE_CACHE_H
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+#include "resource_manager.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * Per napi_env cache of the js strings created by getStringSync. The same value is returned as long as
+ * the resource generation of the resource manager is unchanged.
+ * The cache is off unless it is enabled for the env. Each env is only accessed from its js thread, so the
+ * caches are kept per thread and no lock is taken.
+ */
+class ResourceManagerNapiValueCache {
+public:
+    /**
+     * Enable or disable the cache of the env, the cached values are released when it is disabled
+     *
+     * @param env the env of the js thread
+     * @param isEnabled true to enable the cache, false to disable it
+     * @return true if the cache is in the requested state, else false
+     */
+    static bool SetEnabled(napi_env env, bool isEnabled);
+
+    /**
+     * Get the cached js value
+     *
+     * @param env the env of the js thread
+     * @param resMgr the resource manager the value is got from
+     * @param resId the resource id
+     * @param generation the current generation of the resource manager
+     * @return the js value, nullptr if the cache is disabled, not cached or the cached one is stale
+     */
+    static napi_value Get(napi_env env, const std::shared_ptr<ResourceManager> &resMgr, uint32_t resId,
+        uint64_t generation);
+
+    /**
+     * Put the js value, the least recently used one is evicted when the cache is full, nothing is put if the
+     * cache is disabled
+     *
+     * @param env the env of the js thread
+     * @param resMgr the resource manager the value is got from
+     * @param resId the resource id
+     * @param generation the generation of the resource manager when the value is got
+     * @param value the js value
+     */
+    static void Put(napi_env env, const std::shared_ptr<ResourceManager> &resMgr, uint32_t resId,
+        uint64_t generation, napi_value value);
+
+private:
+    struct Key {
+        const ResourceManager *resMgr;
+        uint32_t resId;
+
+        bool operator==(const Key &other) const
+        {
+            return resMgr == other.resMgr && resId == other.resId;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const
+        {
+            return std::hash<const ResourceManager *>()(key.resMgr) ^ (static_cast<size_t>(key.resId) << 1);
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::weak_ptr<ResourceManager> resMgr;
+        uint64_t generation;
+        napi_ref ref;
+    };
+
+    struct Cache {
+        napi_env env;
+        std::list<Entry> lruList;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries;
+    };
+
+    static Cache *GetCache(napi_env env);
+
+    static void Erase(Cache &cache, std::list<Entry>::iterator iter);
+
+    static void DestroyCache(Cache *cache);
+
+    static void OnEnvCleanUp(void *data);
+
+    // the caches of the envs running on the current thread
+    static thread_local std::unordered_map<napi_env, Cache *> caches_;
+
+    static constexpr size_t MAX_ENTRIES = 256;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -19,6 +19,7 @@
 #include "api_metrics_reporter.h"
 #endif
 #include "hilog/log_cpp.h"
+#include "resource_manager_napi_sync_impl.h"
 #include "resource_manager_napi_utils.h"
 #if !defined(__WINNT__) && !defined(__IDE_PREVIEW__) && !defined(__ARKUI_CROSS__)
 #include "resource_table_loader.h"
@@ -29,6 +30,7 @@ namespace OHOS {
 namespace Global {
 namespace Resource {
 static std::unordered_map<napi_env, napi_ref> g_constructorMap;
+static std::unordered_map<napi_env, napi_ref> g_sendableConstructorMap;
 static std::mutex constructorMutex;
 static std::shared_ptr<ResourceManager> sysResMgr = nullptr;
 static std::mutex sysMgrMutex;
@@ -155,6 +157,28 @@ ResourceManagerAddon::~ResourceManagerAddon()
     RESMGR_HILOGD(RESMGR_JS_TAG, "~ResourceManagerAddon %{public}s", bundleName_.c_str());
 }
 
+std::shared_ptr<ResConfig> ResourceManagerAddon::GetResConfigSnapshot()
+{
+    if (resMgr_ == nullptr) {
+        return nullptr;
+    }
+    // the generation is read before the config, a config changed in between is read again by the next call
+    uint64_t generation = resMgr_->GetConfigGeneration();
+    std::lock_guard<std::mutex> lock(configMutex_);
+    if (configSnapshot_ != nullptr && configGeneration_ == generation) {
+        return configSnapshot_;
+    }
+    std::shared_ptr<ResConfig> config(CreateResConfig());
+    if (config == nullptr) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create the config snapshot");
+        return nullptr;
+    }
+    resMgr_->GetResConfig(*config);
+    configSnapshot_ = config;
+    configGeneration_ = generation;
+    return configSnapshot_;
+}
+
 void ResourceManagerAddon::Destructor(napi_env env, void *nativeObject, void *hint)
 {
     std::unique_ptr<std::shared_ptr<ResourceManagerAddon>> addonPtr;
@@ -226,7 +250,45 @@ napi_property_descriptor ResourceManagerAddon::properties[] = {
     DECLARE_NAPI_FUNCTION("getDoublePluralStringValueSync", GetDoublePluralStringValueSync),
     DECLARE_NAPI_FUNCTION("getIntPluralStringByNameSync", GetIntPluralStringByNameSync),
     DECLARE_NAPI_FUNCTION("getDoublePluralStringByNameSync", GetDoublePluralStringByNameSync),
-    DECLARE_NAPI_FUNCTION("getResourceName", GetResName)
+    DECLARE_NAPI_FUNCTION("getResourceName", GetResName),
+    DECLARE_NAPI_FUNCTION("getValuesSync", GetValuesSync),
+    DECLARE_NAPI_FUNCTION("getSendableResourceManager", GetSendableResourceManager),
+    DECLARE_NAPI_FUNCTION("getIntArrayValueSync", GetIntArrayValueSync),
+    DECLARE_NAPI_FUNCTION("getIntArrayByNameSync", GetIntArrayByNameSync),
+    DECLARE_NAPI_FUNCTION("getConfigGenerationSync", GetConfigGenerationSync),
+    DECLARE_NAPI_FUNCTION("setStringCacheEnabledSync", SetStringCacheEnabledSync)
+};
+
+// only the sync getters which do not change the resource manager are shared with the workers
+napi_property_descriptor ResourceManagerAddon::sendableProperties[] = {
+    DECLARE_NAPI_FUNCTION("getStringSync", GetStringSync),
+    DECLARE_NAPI_FUNCTION("getStringByNameSync", GetStringByNameSync),
+    DECLARE_NAPI_FUNCTION("getBoolean", GetBoolean),
+    DECLARE_NAPI_FUNCTION("getNumber", GetNumber),
+    DECLARE_NAPI_FUNCTION("getBooleanByName", GetBooleanByName),
+    DECLARE_NAPI_FUNCTION("getNumberByName", GetNumberByName),
+    DECLARE_NAPI_FUNCTION("getColorSync", GetColorSync),
+    DECLARE_NAPI_FUNCTION("getColorByNameSync", GetColorByNameSync),
+    DECLARE_NAPI_FUNCTION("getMediaContentBase64Sync", GetMediaContentBase64Sync),
+    DECLARE_NAPI_FUNCTION("getMediaContentSync", GetMediaContentSync),
+    DECLARE_NAPI_FUNCTION("getPluralStringValueSync", GetPluralStringValueSync),
+    DECLARE_NAPI_FUNCTION("getStringArrayValueSync", GetStringArrayValueSync),
+    DECLARE_NAPI_FUNCTION("getRawFileContentSync", GetRawFileContentSync),
+    DECLARE_NAPI_FUNCTION("getRawFileListSync", GetRawFileListSync),
+    DECLARE_NAPI_FUNCTION("getPluralStringByNameSync", GetPluralStringByNameSync),
+    DECLARE_NAPI_FUNCTION("getMediaBase64ByNameSync", GetMediaBase64ByNameSync),
+    DECLARE_NAPI_FUNCTION("getMediaByNameSync", GetMediaByNameSync),
+    DECLARE_NAPI_FUNCTION("getStringArrayByNameSync", GetStringArrayByNameSync),
+    DECLARE_NAPI_FUNCTION("getConfigurationSync", GetConfigurationSync),
+    DECLARE_NAPI_FUNCTION("getDeviceCapabilitySync", GetDeviceCapabilitySync),
+    DECLARE_NAPI_FUNCTION("getIntPluralStringValueSync", GetIntPluralStringValueSync),
+    DECLARE_NAPI_FUNCTION("getDoublePluralStringValueSync", GetDoublePluralStringValueSync),
+    DECLARE_NAPI_FUNCTION("getIntPluralStringByNameSync", GetIntPluralStringByNameSync),
+    DECLARE_NAPI_FUNCTION("getDoublePluralStringByNameSync", GetDoublePluralStringByNameSync),
+    DECLARE_NAPI_FUNCTION("getValuesSync", GetValuesSync),
+    DECLARE_NAPI_FUNCTION("getIntArrayValueSync", GetIntArrayValueSync),
+    DECLARE_NAPI_FUNCTION("getIntArrayByNameSync", GetIntArrayByNameSync),
+    DECLARE_NAPI_FUNCTION("getConfigGenerationSync", GetConfigGenerationSync)
 };
 
 void OnEnvCleanUp(void *data)
@@ -237,6 +299,7 @@ void OnEnvCleanUp(void *data)
     }
     std::lock_guard<std::mutex> lock(constructorMutex);
     g_constructorMap.erase(envData->env);
+    g_sendableConstructorMap.erase(envData->env);
     delete envData;
     envData = nullptr;
 }
@@ -478,12 +541,12 @@ napi_value ResourceManagerAddon::GetStringByNameSync(napi_env env, napi_callback
 
 napi_value ResourceManagerAddon::GetBoolean(napi_env env, napi_callback_info info)
 {
-    return AddonGetResource(env, info, "GetBoolean", FunctionType::SYNC);
+    return ResourceManagerNapiSyncImpl::GetBoolean(env, info);
 }
 
 napi_value ResourceManagerAddon::GetNumber(napi_env env, napi_callback_info info)
 {
-    return AddonGetResource(env, info, "GetNumber", FunctionType::SYNC);
+    return ResourceManagerNapiSyncImpl::GetNumber(env, info);
 }
 
 napi_value ResourceManagerAddon::GetNumberByName(napi_env env, napi_callback_info info)
@@ -508,7 +571,7 @@ napi_value ResourceManagerAddon::GetDrawableDescriptorByName(napi_env env, napi_
 
 napi_value ResourceManagerAddon::GetColorSync(napi_env env, napi_callback_info info)
 {
-    return AddonGetResource(env, info, "GetColorSync", FunctionType::SYNC);
+    return ResourceManagerNapiSyncImpl::GetColorSync(env, info);
 }
 
 napi_value ResourceManagerAddon::GetColorByNameSync(napi_env env, napi_callback_info info)
@@ -661,6 +724,94 @@ napi_value ResourceManagerAddon::GetResName(napi_env env, napi_callback_info inf
 {
     return AddonGetResource(env, info, "GetResName", FunctionType::SYNC);
 }
+
+napi_value ResourceManagerAddon::GetValuesSync(napi_env env, napi_callback_info info)
+{
+    return AddonGetResource(env, info, "GetValuesSync", FunctionType::SYNC);
+}
+
+napi_value ResourceManagerAddon::GetIntArrayValueSync(napi_env env, napi_callback_info info)
+{
+    return ResourceManagerNapiSyncImpl::GetIntArrayValueSync(env, info);
+}
+
+napi_value ResourceManagerAddon::GetIntArrayByNameSync(napi_env env, napi_callback_info info)
+{
+    return ResourceManagerNapiSyncImpl::GetIntArrayByNameSync(env, info);
+}
+
+napi_value ResourceManagerAddon::GetConfigGenerationSync(napi_env env, napi_callback_info info)
+{
+    return ResourceManagerNapiSyncImpl::GetConfigGenerationSync(env, info);
+}
+
+napi_value ResourceManagerAddon::SetStringCacheEnabledSync(napi_env env, napi_callback_info info)
+{
+    return ResourceManagerNapiSyncImpl::SetStringCacheEnabledSync(env, info);
+}
+
+napi_value ResourceManagerAddon::GetSendableResourceManager(napi_env env, napi_callback_info info)
+{
+    auto addon = ResMgrDataContext::GetResourceManagerAddon(env, info);
+    if (addon == nullptr) {
+        return nullptr;
+    }
+    return WrapSendableResourceManager(env, addon);
+}
+
+napi_value ResourceManagerAddon::WrapSendableResourceManager(napi_env env,
+    std::shared_ptr<ResourceManagerAddon> &addon)
+{
+    napi_value constructor = GetSendableConstructor(env);
+    if (constructor == nullptr) {
+        return nullptr;
+    }
+    napi_value result = nullptr;
+    napi_status status = napi_new_instance(env, constructor, 0, nullptr, &result);
+    if (status != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to new sendable instance, status = %{public}d", status);
+        return nullptr;
+    }
+
+    // the sendable object shares the addon, so the workers use the same native resource manager
+    auto addonPtr = std::make_unique<std::shared_ptr<ResourceManagerAddon>>(addon);
+    status = napi_wrap_sendable(env, result, reinterpret_cast<void *>(addonPtr.get()),
+        ResourceManagerAddon::Destructor, nullptr);
+    if (status != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to wrap sendable resource manager, status = %{public}d", status);
+        return nullptr;
+    }
+    addonPtr.release();
+    return result;
+}
+
+napi_value ResourceManagerAddon::GetSendableConstructor(napi_env env)
+{
+    if (!Init(env)) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(constructorMutex);
+    napi_value constructor = nullptr;
+    auto it = g_sendableConstructorMap.find(env);
+    if (it != g_sendableConstructorMap.end()) {
+        napi_get_reference_value(env, it->second, &constructor);
+        return constructor;
+    }
+    napi_status status = napi_define_sendable_class(env, "SendableResourceManager", NAPI_AUTO_LENGTH, New, nullptr,
+        sizeof(sendableProperties) / sizeof(napi_property_descriptor), sendableProperties, nullptr, &constructor);
+    if (status != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to define sendable class, status = %{public}d", status);
+        return nullptr;
+    }
+    napi_ref constructorRef = nullptr;
+    status = napi_create_reference(env, constructor, 1, &constructorRef);
+    if (status != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create reference of sendable class, status = %{public}d", status);
+        return nullptr;
+    }
+    g_sendableConstructorMap[env] = constructorRef;
+    return constructor;
+}
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -15,7 +15,9 @@
 
 #include "resource_manager_napi_async_impl.h"
 
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 #if !defined(__IDE_PREVIEW__)
 #include "hisysevent_adapter.h"
 #include "hitrace_meter.h"
@@ -27,6 +29,9 @@ namespace Resource {
 using namespace std::placeholders;
 constexpr int PARAMS_NUM_TWO = 2;
 constexpr int PARAMS_NUM_THREE = 3;
+std::mutex ResourceManagerNapiAsyncImpl::batchMutex_;
+std::unordered_map<napi_env, ResourceManagerNapiAsyncImpl::AsyncBatch*> ResourceManagerNapiAsyncImpl::pendingBatches_;
+
 ResourceManagerNapiAsyncImpl::ResourceManagerNapiAsyncImpl()
 {}
 
@@ -116,10 +121,8 @@ napi_value GetCallbackErrorCode(napi_env env, const int32_t errCode, const std::
     return error;
 }
 
-void ResourceManagerNapiAsyncImpl::Complete(napi_env env, napi_status status, void* data)
+void ResourceManagerNapiAsyncImpl::SettleResult(napi_env env, ResMgrDataContext* dataContext)
 {
-    ResMgrDataContext* dataContext = static_cast<ResMgrDataContext*>(data);
-
     napi_value finalResult = nullptr;
     if (dataContext->createValueFunc_ != nullptr) {
         finalResult = dataContext->createValueFunc_(env, *dataContext);
@@ -165,9 +168,141 @@ void ResourceManagerNapiAsyncImpl::Complete(napi_env env, napi_status status, vo
             }
         } while (false);
     }
-    napi_delete_async_work(env, dataContext->work_);
-    delete dataContext;
-};
+}
+
+void ResourceManagerNapiAsyncImpl::ExecuteBatch(napi_env env, void* data)
+{
+    AsyncBatch* batch = static_cast<AsyncBatch*>(data);
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        batch->isStarted = true;
+        auto iter = pendingBatches_.find(env);
+        if (iter != pendingBatches_.end() && iter->second == batch) {
+            pendingBatches_.erase(iter);
+        }
+    }
+    // run the requests of the same resource manager together for the locality of the reads
+    std::vector<ResMgrDataContext*> dataContexts(batch->dataContexts);
+    std::stable_sort(dataContexts.begin(), dataContexts.end(), [](ResMgrDataContext* left, ResMgrDataContext* right) {
+        return left->addon_.get() < right->addon_.get();
+    });
+    std::vector<ResMgrDataContext*> group;
+    for (auto dataContext : dataContexts) {
+        if (!group.empty() && group.front()->addon_ != dataContext->addon_) {
+            ExecuteGroup(env, group);
+            group.clear();
+        }
+        group.push_back(dataContext);
+    }
+    if (!group.empty()) {
+        ExecuteGroup(env, group);
+    }
+}
+
+void ResourceManagerNapiAsyncImpl::ExecuteGroup(napi_env env, const std::vector<ResMgrDataContext*> &group)
+{
+    const std::shared_ptr<ResourceManagerAddon> &addon = group.front()->addon_;
+    std::shared_ptr<ResourceManager> resMgr = addon != nullptr ? addon->GetResMgr() : nullptr;
+    if (resMgr == nullptr) {
+        for (auto dataContext : group) {
+            dataContext->execute_(env, dataContext);
+        }
+        return;
+    }
+    // the config generation only changes under the write lock of the config, so the requests run between two
+    // equal generations are all resolved against the same config, else the ones reading the config run again
+    uint64_t generation = resMgr->GetConfigGeneration();
+    for (auto dataContext : group) {
+        dataContext->execute_(env, dataContext);
+    }
+    for (int retry = 0; retry < MAX_CONFIG_RETRY; ++retry) {
+        uint64_t current = resMgr->GetConfigGeneration();
+        if (current == generation) {
+            return;
+        }
+        generation = current;
+        for (auto dataContext : group) {
+            if (dataContext->isConfigDependent_) {
+                dataContext->ResetResult();
+                dataContext->execute_(env, dataContext);
+            }
+        }
+    }
+    if (generation != resMgr->GetConfigGeneration()) {
+        RESMGR_HILOGW(RESMGR_JS_TAG, "The config keeps changing, %{public}zu requests may see different configs",
+            group.size());
+    }
+}
+
+void ResourceManagerNapiAsyncImpl::CompleteBatch(napi_env env, napi_status status, void* data)
+{
+    AsyncBatch* batch = static_cast<AsyncBatch*>(data);
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        auto iter = pendingBatches_.find(env);
+        if (iter != pendingBatches_.end() && iter->second == batch) {
+            pendingBatches_.erase(iter);
+        }
+    }
+    for (auto dataContext : batch->dataContexts) {
+        SettleResult(env, dataContext);
+        delete dataContext;
+    }
+    napi_delete_async_work(env, batch->work);
+    delete batch;
+}
+
+size_t ResourceManagerNapiAsyncImpl::GetRequestCost(const std::string &name)
+{
+    static const std::unordered_set<std::string> heavyRequests {
+        "getMedia", "getMediaContent", "getMediaByName", "GetMediaBase64", "getMediaContentBase64",
+        "GetMediaBase64ByName", "getRawFile", "getRawFileContent", "getRawFileList"
+    };
+    return heavyRequests.find(name) != heavyRequests.end() ? HEAVY_REQUEST_COST : LIGHT_REQUEST_COST;
+}
+
+bool ResourceManagerNapiAsyncImpl::IsConfigDependent(const std::string &name)
+{
+    // the raw files do not depend on the config, and opening or closing a fd twice is not harmless
+    static const std::unordered_set<std::string> rawFileRequests {
+        "getRawFile", "getRawFileContent", "getRawFd", "getRawFileDescriptor", "closeRawFd",
+        "closeRawFileDescriptor", "getRawFileList"
+    };
+    return rawFileRequests.find(name) == rawFileRequests.end();
+}
+
+bool ResourceManagerNapiAsyncImpl::AddToPendingBatch(napi_env env, std::unique_ptr<ResMgrDataContext> &dataContext,
+    const std::string &name)
+{
+    size_t cost = GetRequestCost(name);
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    auto iter = pendingBatches_.find(env);
+    if (iter != pendingBatches_.end() && !iter->second->isStarted
+        && iter->second->cost + cost <= MAX_BATCH_COST) {
+        iter->second->cost += cost;
+        iter->second->dataContexts.push_back(dataContext.release());
+        return true;
+    }
+
+    auto batch = std::make_unique<AsyncBatch>();
+    napi_value resource = nullptr;
+    napi_create_string_utf8(env, name.c_str(), NAPI_AUTO_LENGTH, &resource);
+    if (napi_create_async_work(env, nullptr, resource, ResourceManagerNapiAsyncImpl::ExecuteBatch,
+        ResourceManagerNapiAsyncImpl::CompleteBatch, static_cast<void*>(batch.get()), &batch->work) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create async work for %{public}s", name.c_str());
+        return false;
+    }
+    batch->cost = cost;
+    batch->dataContexts.push_back(dataContext.get());
+    if (napi_queue_async_work_with_qos(env, batch->work, napi_qos_user_initiated) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to queue async work for %{public}s", name.c_str());
+        napi_delete_async_work(env, batch->work);
+        return false;
+    }
+    dataContext.release();
+    pendingBatches_[env] = batch.release();
+    return true;
+}
 
 napi_value ResourceManagerNapiAsyncImpl::GetResult(napi_env env, std::unique_ptr<ResMgrDataContext> &dataContext,
     const std::string &name, napi_async_execute_callback &execute)
@@ -178,20 +313,11 @@ napi_value ResourceManagerNapiAsyncImpl::GetResult(napi_env env, std::unique_ptr
     } else {
         napi_get_undefined(env, &result);
     }
-    napi_value resource = nullptr;
-    napi_create_string_utf8(env, name.c_str(), NAPI_AUTO_LENGTH, &resource);
-    if (napi_create_async_work(env, nullptr, resource, execute, ResourceManagerNapiAsyncImpl::Complete,
-        static_cast<void*>(dataContext.get()), &dataContext->work_) != napi_ok) {
-        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create async work for %{public}s", name.c_str());
+    dataContext->execute_ = execute;
+    dataContext->isConfigDependent_ = IsConfigDependent(name);
+    if (!AddToPendingBatch(env, dataContext, name)) {
         dataContext->Release(env);
-        return result;
     }
-    if (napi_queue_async_work_with_qos(env, dataContext->work_, napi_qos_user_initiated) != napi_ok) {
-        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to queue async work for %{public}s", name.c_str());
-        dataContext->Release(env);
-        return result;
-    }
-    dataContext.release();
     return result;
 }
 
@@ -23,6 +23,7 @@
 #include "drawable_descriptor/js_drawable_descriptor.h"
 #include "resource_manager_napi_utils.h"
 #include "resource_manager_addon.h"
+#include "resource_manager_napi_value_cache.h"
 #include "utils/utils.h"
 
 namespace OHOS {
@@ -46,20 +47,14 @@ std::unordered_map<std::string, std::function<napi_value(napi_env&, napi_callbac
         return ResourceManagerNapiSyncImpl::GetStringSync(env, info);}},
     {"GetStringByNameSync", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetStringByNameSync(env, info);}},
-    {"GetBoolean", [](napi_env& env, napi_callback_info& info) -> napi_value {
-        return ResourceManagerNapiSyncImpl::GetBoolean(env, info);}},
     {"GetBooleanByName", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetBooleanByName(env, info);}},
-    {"GetNumber", [](napi_env& env, napi_callback_info& info) -> napi_value {
-        return ResourceManagerNapiSyncImpl::GetNumber(env, info);}},
     {"GetNumberByName", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetNumberByName(env, info);}},
     {"GetDrawableDescriptor", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetDrawableDescriptor(env, info);}},
     {"GetDrawableDescriptorByName", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetDrawableDescriptorByName(env, info);}},
-    {"GetColorSync", [](napi_env& env, napi_callback_info& info) -> napi_value {
-        return ResourceManagerNapiSyncImpl::GetColorSync(env, info);}},
     {"GetColorByNameSync", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetColorByNameSync(env, info);}},
     {"AddResource", [](napi_env& env, napi_callback_info& info) -> napi_value {
@@ -118,6 +113,8 @@ std::unordered_map<std::string, std::function<napi_value(napi_env&, napi_callbac
         return ResourceManagerNapiSyncImpl::GetDoublePluralStringByNameSync(env, info);}},
     {"GetResName", [](napi_env& env, napi_callback_info& info) -> napi_value {
         return ResourceManagerNapiSyncImpl::GetResName(env, info);}},
+    {"GetValuesSync", [](napi_env& env, napi_callback_info& info) -> napi_value {
+        return ResourceManagerNapiSyncImpl::GetValuesSync(env, info);}},
 };
 
 napi_value ResourceManagerNapiSyncImpl::GetResource(napi_env env, napi_callback_info info,
@@ -318,6 +315,21 @@ int32_t ResourceManagerNapiSyncImpl::InitIdResourceAddon(napi_env env, napi_call
     return SUCCESS;
 }
 
+bool ResourceManagerNapiSyncImpl::GetResMgrById(napi_env env, napi_value thisVar, size_t argc, napi_value *argv,
+    std::shared_ptr<ResourceManager> &resMgr, uint32_t &resId)
+{
+    if (argc == 0 || ResourceManagerNapiUtils::GetType(env, argv[ARRAY_SUBCRIPTOR_ZERO]) != napi_number) {
+        return false;
+    }
+    auto addon = ResMgrDataContext::UnwrapAddon(env, thisVar);
+    if (addon == nullptr) {
+        return false;
+    }
+    resMgr = addon->GetResMgr();
+    resId = ResourceManagerNapiUtils::GetResId(env, argc, argv);
+    return resMgr != nullptr;
+}
+
 int32_t ResourceManagerNapiSyncImpl::ProcessStrResource(napi_env env, napi_callback_info info,
     std::unique_ptr<ResMgrDataContext> &dataContext)
 {
@@ -343,10 +355,41 @@ int32_t ResourceManagerNapiSyncImpl::ProcessStrResource(napi_env env, napi_callb
     return SUCCESS;
 }
 
+napi_value ResourceManagerNapiSyncImpl::GetCachedStringById(napi_env env,
+    const std::shared_ptr<ResourceManager> &resMgr, uint32_t resId)
+{
+    uint64_t generation = resMgr->GetResourceGeneration();
+    napi_value result = ResourceManagerNapiValueCache::Get(env, resMgr, resId, generation);
+    if (result != nullptr) {
+        return result;
+    }
+    std::string value;
+    std::vector<std::tuple<ResourceManager::NapiValueType, std::string>> jsParams;
+    RState state = resMgr->GetStringFormatById(resId, value, jsParams);
+    if (state != RState::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "GetStringSync failed state, id = %{public}u", resId);
+        ResourceManagerNapiUtils::NapiThrow(env, state, resId);
+        return nullptr;
+    }
+    if (napi_create_string_utf8(env, value.c_str(), NAPI_AUTO_LENGTH, &result) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create js string in GetStringSync");
+        return nullptr;
+    }
+    ResourceManagerNapiValueCache::Put(env, resMgr, resId, generation, result);
+    return result;
+}
+
 napi_value ResourceManagerNapiSyncImpl::GetStringSync(napi_env env, napi_callback_info info)
 {
     GET_PARAMS(env, info, PARAMS_NUM_TWO);
 
+    // the string without format arguments is the same js string until the resources or the config change
+    std::shared_ptr<ResourceManager> resMgr = nullptr;
+    uint32_t resId = 0;
+    if (argc == 1 && GetResMgrById(env, thisVar, argc, argv, resMgr, resId)) {
+        return GetCachedStringById(env, resMgr, resId);
+    }
+
     auto dataContext = std::make_unique<ResMgrDataContext>();
     if (dataContext == nullptr) {
         return nullptr;
@@ -436,6 +479,23 @@ napi_value ResourceManagerNapiSyncImpl::GetColorSync(napi_env env, napi_callback
 {
     GET_PARAMS(env, info, PARAMS_NUM_TWO);
 
+    std::shared_ptr<ResourceManager> resMgr = nullptr;
+    uint32_t resId = 0;
+    if (GetResMgrById(env, thisVar, argc, argv, resMgr, resId)) {
+        uint32_t colorValue = 0;
+        RState state = resMgr->GetColorById(resId, colorValue);
+        if (state != RState::SUCCESS) {
+            ResourceManagerNapiUtils::NapiThrow(env, state, resId);
+            return nullptr;
+        }
+        napi_value jsValue = nullptr;
+        if (napi_create_uint32(env, colorValue, &jsValue) != napi_ok) {
+            RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create js color in GetColorSync");
+            return nullptr;
+        }
+        return jsValue;
+    }
+
     auto dataContext = std::make_unique<ResMgrDataContext>();
     if (dataContext == nullptr) {
         return nullptr;
@@ -457,6 +517,60 @@ napi_value ResourceManagerNapiSyncImpl::GetColorSync(napi_env env, napi_callback
     return ResourceManagerNapiUtils::CreateJsColor(env, *dataContext);
 }
 
+napi_value ResourceManagerNapiSyncImpl::GetIntArrayValueSync(napi_env env, napi_callback_info info)
+{
+    GET_PARAMS(env, info, PARAMS_NUM_TWO);
+
+    std::shared_ptr<ResourceManager> resMgr = nullptr;
+    uint32_t resId = 0;
+    if (!GetResMgrById(env, thisVar, argc, argv, resMgr, resId)) {
+        auto dataContext = std::make_unique<ResMgrDataContext>();
+        int32_t state = InitIdResourceAddon(env, info, dataContext);
+        if (state != RState::SUCCESS) {
+            dataContext->SetErrorMsg("Failed to init para in GetIntArrayValueSync", true);
+            ResourceManagerNapiUtils::NapiThrowBusinessError(env, state);
+            return nullptr;
+        }
+        if (!ResourceManagerNapiUtils::GetHapResourceManager(dataContext.get(), resMgr, resId)) {
+            RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to get resMgr in GetIntArrayValueSync");
+            ResourceManagerNapiUtils::NapiThrowBusinessError(env, ERROR_CODE_RES_NOT_FOUND_BY_ID, resId);
+            return nullptr;
+        }
+    }
+    std::shared_ptr<const std::vector<int32_t>> intArray;
+    RState state = resMgr->GetSharedIntArrayById(resId, intArray);
+    if (state != RState::SUCCESS || intArray == nullptr) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to GetSharedIntArrayById, id = %{public}u", resId);
+        ResourceManagerNapiUtils::NapiThrowBusinessError(env, ERROR_CODE_RES_NOT_FOUND_BY_ID, resId);
+        return nullptr;
+    }
+    return ResourceManagerNapiUtils::CreateJsInt32Array(env, *intArray);
+}
+
+napi_value ResourceManagerNapiSyncImpl::GetIntArrayByNameSync(napi_env env, napi_callback_info info)
+{
+    GET_PARAMS(env, info, PARAMS_NUM_TWO);
+    if (!ResourceManagerNapiUtils::IsNapiString(env, info)) {
+        ResourceManagerNapiUtils::NapiThrowBusinessError(env, ERROR_CODE_INVALID_INPUT_PARAMETER);
+        return nullptr;
+    }
+    auto dataContext = std::make_unique<ResMgrDataContext>();
+    int32_t state = InitNameAddon(env, info, dataContext);
+    if (state != RState::SUCCESS) {
+        dataContext->SetErrorMsg("Failed to init para in GetIntArrayByNameSync", false);
+        ResourceManagerNapiUtils::NapiThrowBusinessError(env, state);
+        return nullptr;
+    }
+    std::shared_ptr<const std::vector<int32_t>> intArray;
+    state = dataContext->addon_->GetResMgr()->GetSharedIntArrayByName(dataContext->resName_.c_str(), intArray);
+    if (state != RState::SUCCESS || intArray == nullptr) {
+        dataContext->SetErrorMsg("Failed to GetSharedIntArrayByName", false);
+        ResourceManagerNapiUtils::NapiThrowBusinessError(env, ERROR_CODE_RES_NOT_FOUND_BY_NAME);
+        return nullptr;
+    }
+    return ResourceManagerNapiUtils::CreateJsInt32Array(env, *intArray);
+}
+
 int32_t ResourceManagerNapiSyncImpl::ProcessNumResource(napi_env env, napi_callback_info info,
     std::unique_ptr<ResMgrDataContext> &dataContext)
 {
@@ -480,6 +594,29 @@ napi_value ResourceManagerNapiSyncImpl::GetNumber(napi_env env, napi_callback_in
 {
     GET_PARAMS(env, info, PARAMS_NUM_TWO);
 
+    std::shared_ptr<ResourceManager> resMgr = nullptr;
+    uint32_t resId = 0;
+    if (GetResMgrById(env, thisVar, argc, argv, resMgr, resId)) {
+        int intValue = 0;
+        float floatValue = 0.0f;
+        RState state = resMgr->GetIntegerById(resId, intValue);
+        if (state != RState::SUCCESS) {
+            state = resMgr->GetFloatById(resId, floatValue);
+        }
+        if (state != RState::SUCCESS) {
+            ResourceManagerNapiUtils::NapiThrow(env, state, resId);
+            return nullptr;
+        }
+        napi_value jsValue = nullptr;
+        napi_status status = intValue != 0 ? napi_create_int32(env, intValue, &jsValue) :
+            napi_create_double(env, floatValue, &jsValue);
+        if (status != napi_ok) {
+            RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create js number in GetNumber");
+            return nullptr;
+        }
+        return jsValue;
+    }
+
     auto dataContext = std::make_unique<ResMgrDataContext>();
     if (dataContext == nullptr) {
         return nullptr;
@@ -523,6 +660,23 @@ napi_value ResourceManagerNapiSyncImpl::GetBoolean(napi_env env, napi_callback_i
 {
     GET_PARAMS(env, info, PARAMS_NUM_TWO);
 
+    std::shared_ptr<ResourceManager> resMgr = nullptr;
+    uint32_t resId = 0;
+    if (GetResMgrById(env, thisVar, argc, argv, resMgr, resId)) {
+        bool boolValue = false;
+        RState state = resMgr->GetBooleanById(resId, boolValue);
+        if (state != RState::SUCCESS) {
+            ResourceManagerNapiUtils::NapiThrow(env, state, resId);
+            return nullptr;
+        }
+        napi_value jsValue = nullptr;
+        if (napi_get_boolean(env, boolValue, &jsValue) != napi_ok) {
+            RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create js boolean in GetBoolean");
+            return nullptr;
+        }
+        return jsValue;
+    }
+
     std::unique_ptr<ResMgrDataContext> dataContext = std::make_unique<ResMgrDataContext>();
 
     int32_t state = ResourceManagerNapiSyncImpl::InitIdResourceAddon(env, info, dataContext);
@@ -1298,6 +1452,38 @@ napi_value ResourceManagerNapiSyncImpl::GetDeviceCapabilitySync(napi_env env, na
     return ResourceManagerNapiUtils::CreateJsDeviceCap(env, *dataContext);
 }
 
+napi_value ResourceManagerNapiSyncImpl::GetConfigGenerationSync(napi_env env, napi_callback_info info)
+{
+    GET_PARAMS(env, info, PARAMS_NUM_TWO);
+    auto addon = ResMgrDataContext::UnwrapAddon(env, thisVar);
+    if (addon == nullptr || addon->GetResMgr() == nullptr) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to get addon in GetConfigGenerationSync");
+        return nullptr;
+    }
+    napi_value result = nullptr;
+    if (napi_create_int64(env, static_cast<int64_t>(addon->GetResMgr()->GetConfigGeneration()), &result) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create config generation");
+        return nullptr;
+    }
+    return result;
+}
+
+napi_value ResourceManagerNapiSyncImpl::SetStringCacheEnabledSync(napi_env env, napi_callback_info info)
+{
+    GET_PARAMS(env, info, PARAMS_NUM_TWO);
+    bool isEnabled = false;
+    if (argc == 0 || ResourceManagerNapiUtils::GetType(env, argv[ARRAY_SUBCRIPTOR_ZERO]) != napi_boolean ||
+        napi_get_value_bool(env, argv[ARRAY_SUBCRIPTOR_ZERO], &isEnabled) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Invalid param in SetStringCacheEnabledSync");
+        ResourceManagerNapiUtils::NapiThrow(env, ERROR_CODE_INVALID_INPUT_PARAMETER);
+        return nullptr;
+    }
+    if (!ResourceManagerNapiValueCache::SetEnabled(env, isEnabled)) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to set the string cache, isEnabled = %{public}d", isEnabled);
+    }
+    return nullptr;
+}
+
 napi_value ResourceManagerNapiSyncImpl::GetLocales(napi_env env, napi_callback_info info)
 {
     GET_PARAMS(env, info, PARAMS_NUM_TWO);
@@ -1655,6 +1841,97 @@ napi_value ResourceManagerNapiSyncImpl::GetResName(napi_env env, napi_callback_i
 
     return ResourceManagerNapiUtils::CreateJsString(env, *dataContext);
 }
+
+int32_t ResourceManagerNapiSyncImpl::InitBatchItems(napi_env env, size_t argc, napi_value *argv,
+    std::vector<ResourceManager::BatchItem> &items)
+{
+    // the value types of the batch, same as ResourceManager_ResourceType of the NDK
+    static const ResType BATCH_TYPES[] = {
+        ResType::STRING, ResType::COLOR, ResType::FLOAT, ResType::INTEGER, ResType::BOOLEAN
+    };
+    bool isIdArray = false;
+    bool isTypeArray = false;
+    if (argc < PARAMS_NUM_TWO || napi_is_array(env, argv[ARRAY_SUBCRIPTOR_ZERO], &isIdArray) != napi_ok ||
+        napi_is_array(env, argv[ARRAY_SUBCRIPTOR_ONE], &isTypeArray) != napi_ok || !isIdArray || !isTypeArray) {
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    uint32_t idCount = 0;
+    uint32_t typeCount = 0;
+    if (napi_get_array_length(env, argv[ARRAY_SUBCRIPTOR_ZERO], &idCount) != napi_ok ||
+        napi_get_array_length(env, argv[ARRAY_SUBCRIPTOR_ONE], &typeCount) != napi_ok || idCount != typeCount) {
+        return ERROR_CODE_INVALID_INPUT_PARAMETER;
+    }
+    items.resize(idCount);
+    for (uint32_t i = 0; i < idCount; ++i) {
+        napi_value id = nullptr;
+        napi_value type = nullptr;
+        uint32_t typeValue = 0;
+        if (napi_get_element(env, argv[ARRAY_SUBCRIPTOR_ZERO], i, &id) != napi_ok ||
+            napi_get_value_uint32(env, id, &items[i].id) != napi_ok ||
+            napi_get_element(env, argv[ARRAY_SUBCRIPTOR_ONE], i, &type) != napi_ok ||
+            napi_get_value_uint32(env, type, &typeValue) != napi_ok ||
+            typeValue >= sizeof(BATCH_TYPES) / sizeof(BATCH_TYPES[0])) {
+            RESMGR_HILOGE(RESMGR_JS_TAG, "invalid batch item, index = %{public}u", i);
+            return ERROR_CODE_INVALID_INPUT_PARAMETER;
+        }
+        items[i].type = BATCH_TYPES[typeValue];
+    }
+    return SUCCESS;
+}
+
+napi_value ResourceManagerNapiSyncImpl::CreateJsBatchValues(napi_env env,
+    const std::vector<ResourceManager::BatchItem> &items, const std::string &arena)
+{
+    napi_value result = nullptr;
+    if (napi_create_array_with_length(env, items.size(), &result) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create batch values array");
+        return nullptr;
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        const ResourceManager::BatchItem &item = items[i];
+        napi_value value = nullptr;
+        if (item.state != SUCCESS) {
+            napi_get_undefined(env, &value);
+        } else if (item.type == ResType::STRING) {
+            napi_create_string_utf8(env, arena.data() + item.stringOffset, item.stringLen, &value);
+        } else if (item.type == ResType::COLOR) {
+            napi_create_uint32(env, item.colorValue, &value);
+        } else if (item.type == ResType::FLOAT) {
+            napi_create_double(env, item.floatValue, &value);
+        } else if (item.type == ResType::INTEGER) {
+            napi_create_int32(env, item.intValue, &value);
+        } else {
+            napi_get_boolean(env, item.boolValue, &value);
+        }
+        if (napi_set_element(env, result, i, value) != napi_ok) {
+            RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to set batch value, index = %{public}zu", i);
+            return nullptr;
+        }
+    }
+    return result;
+}
+
+napi_value ResourceManagerNapiSyncImpl::GetValuesSync(napi_env env, napi_callback_info info)
+{
+    GET_PARAMS(env, info, PARAMS_NUM_TWO);
+
+    std::shared_ptr<ResourceManagerAddon> addon = ResMgrDataContext::GetResourceManagerAddon(env, info);
+    if (addon == nullptr || addon->GetResMgr() == nullptr) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to get addon in GetValuesSync");
+        ResourceManagerNapiUtils::NapiThrow(env, NOT_FOUND);
+        return nullptr;
+    }
+    std::vector<ResourceManager::BatchItem> items;
+    int32_t state = InitBatchItems(env, argc, argv, items);
+    if (state != RState::SUCCESS) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to init para in GetValuesSync");
+        ResourceManagerNapiUtils::NapiThrow(env, state);
+        return nullptr;
+    }
+    std::string arena;
+    addon->GetResMgr()->GetResourcesByIds(items, arena);
+    return CreateJsBatchValues(env, items, arena);
+}
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
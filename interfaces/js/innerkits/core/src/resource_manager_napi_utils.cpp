@@ -15,8 +15,9 @@
 
 #include "resource_manager_napi_utils.h"
 
+#include <algorithm>
+
 #include "hilog/log_cpp.h"
-#include "securec.h"
 #include "utils/string_utils.h"
 
 namespace OHOS {
@@ -223,33 +224,59 @@ napi_value ResourceManagerNapiUtils::CreateJsArray(napi_env env, ResMgrDataConte
     return result;
 }
 
+static void ReleaseMediaData(napi_env env, void *data, void *hint)
+{
+    delete[] static_cast<uint8_t *>(data);
+}
+
 napi_value ResourceManagerNapiUtils::CreateJsUint8Array(napi_env env, ResMgrDataContext &context)
 {
     napi_value buffer;
-    uint8_t *data;
-    napi_status status = napi_create_arraybuffer(env, context.len_, reinterpret_cast<void **>(&data), &buffer);
+    napi_status status;
+    size_t len = 0;
+    if (context.len_ == 0 || context.mediaData == nullptr) {
+        void *data = nullptr;
+        status = napi_create_arraybuffer(env, 0, &data, &buffer);
+    } else {
+        // hand the extracted media over to the array buffer, it is released by the finalizer when gc
+        status = napi_create_external_arraybuffer(env, context.mediaData.get(), context.len_,
+            ReleaseMediaData, nullptr, &buffer);
+        if (status == napi_ok) {
+            context.mediaData.release();
+            len = context.len_;
+        }
+    }
     if (status != napi_ok) {
         context.SetErrorMsg("Failed to create media array buffer");
         return nullptr;
     }
 
     napi_value result = nullptr;
-    status = napi_create_typedarray(env, napi_uint8_array, context.len_, buffer, 0, &result);
+    status = napi_create_typedarray(env, napi_uint8_array, len, buffer, 0, &result);
     if (status != napi_ok) {
         context.SetErrorMsg("Failed to create media typed array");
         return nullptr;
     }
+    return result;
+}
 
-    if (context.len_ == 0) {
-        return result;
+napi_value ResourceManagerNapiUtils::CreateJsInt32Array(napi_env env, const std::vector<int32_t> &value)
+{
+    // the array buffer is writable by js, so the shared array is copied in one pass instead of being wrapped
+    void *data = nullptr;
+    napi_value buffer = nullptr;
+    if (napi_create_arraybuffer(env, value.size() * sizeof(int32_t), &data, &buffer) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create int array buffer");
+        return nullptr;
+    }
+    if (!value.empty()) {
+        std::copy_n(value.data(), value.size(), static_cast<int32_t *>(data));
     }
 
-    uint8_t *tempData = context.mediaData.release();
-    int ret = memcpy_s(data, context.len_, tempData, context.len_);
-    delete[] tempData;
-    if (ret != 0) {
-        context.SetErrorMsg("Failed to copy media to buffer");
-        return result;
+    napi_value result = nullptr;
+    if (napi_create_typedarray(env, napi_int32_array, value.size(), buffer, 0, &result) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create int typed array");
+        return nullptr;
     }
     return result;
 }
@@ -483,12 +510,11 @@ bool ResourceManagerNapiUtils::GetHapResourceManager(const ResMgrDataContext* da
 
 napi_value ResourceManagerNapiUtils::CreateJsDeviceCap(napi_env env, ResMgrDataContext& context)
 {
-    std::unique_ptr<ResConfig> cfg(CreateResConfig());
+    std::shared_ptr<ResConfig> cfg = context.addon_->GetResConfigSnapshot();
     if (!cfg) {
         context.SetErrorMsg("Failed to create ResConfig object.");
         return nullptr;
     }
-    context.addon_->GetResMgr()->GetResConfig(*cfg);
 
     napi_value result;
     napi_status status = napi_create_object(env, &result);
@@ -524,11 +550,11 @@ napi_value ResourceManagerNapiUtils::CreateJsDeviceCap(napi_env env, ResMgrDataC
 }
 
 
-std::string ResourceManagerNapiUtils::GetLocale(std::unique_ptr<ResConfig> &cfg)
+std::string ResourceManagerNapiUtils::GetLocale(const ResConfig &cfg)
 {
     std::string result;
 #ifdef SUPPORT_GRAPHICS
-    const icu::Locale *localeInfo = cfg->GetLocaleInfo();
+    const icu::Locale *localeInfo = cfg.GetLocaleInfo();
     if (localeInfo == nullptr) {
         return result;
     }
@@ -553,13 +579,12 @@ std::string ResourceManagerNapiUtils::GetLocale(std::unique_ptr<ResConfig> &cfg)
 
 napi_value ResourceManagerNapiUtils::CreateJsConfig(napi_env env, ResMgrDataContext& context)
 {
-    std::unique_ptr<ResConfig> cfg(CreateResConfig());
+    std::shared_ptr<ResConfig> cfg = context.addon_->GetResConfigSnapshot();
     if (!cfg) {
         context.SetErrorMsg("Failed to create ResConfig object.");
         return nullptr;
     }
-    context.addon_->GetResMgr()->GetResConfig(*cfg);
-    return CreateConfig(env, context, cfg);
+    return CreateConfig(env, context, *cfg);
 }
 
 napi_value ResourceManagerNapiUtils::CreateOverrideJsConfig(napi_env env, ResMgrDataContext& context)
@@ -570,11 +595,11 @@ napi_value ResourceManagerNapiUtils::CreateOverrideJsConfig(napi_env env, ResMgr
         return nullptr;
     }
     context.addon_->GetResMgr()->GetOverrideResConfig(*cfg);
-    return CreateConfig(env, context, cfg);
+    return CreateConfig(env, context, *cfg);
 }
 
 napi_value ResourceManagerNapiUtils::CreateConfig(napi_env env,
-    ResMgrDataContext& context, std::unique_ptr<ResConfig> &cfg)
+    ResMgrDataContext& context, const ResConfig &cfg)
 {
     napi_value result;
     napi_status status = napi_create_object(env, &result);
@@ -597,12 +622,12 @@ napi_value ResourceManagerNapiUtils::CreateConfig(napi_env env,
     }
 
     // write other int properties
-    SetIntProperty(env, context, result, "direction", static_cast<int>(cfg->GetDirection()));
-    SetIntProperty(env, context, result, "deviceType", static_cast<int>(cfg->GetDeviceType()));
-    SetIntProperty(env, context, result, "screenDensity", static_cast<int>(cfg->GetScreenDensityDpi()));
-    SetIntProperty(env, context, result, "colorMode", static_cast<int>(cfg->GetColorMode()));
-    SetIntProperty(env, context, result, "mcc", static_cast<int>(cfg->GetMcc()));
-    SetIntProperty(env, context, result, "mnc", static_cast<int>(cfg->GetMnc()));
+    SetIntProperty(env, context, result, "direction", static_cast<int>(cfg.GetDirection()));
+    SetIntProperty(env, context, result, "deviceType", static_cast<int>(cfg.GetDeviceType()));
+    SetIntProperty(env, context, result, "screenDensity", static_cast<int>(cfg.GetScreenDensityDpi()));
+    SetIntProperty(env, context, result, "colorMode", static_cast<int>(cfg.GetColorMode()));
+    SetIntProperty(env, context, result, "mcc", static_cast<int>(cfg.GetMcc()));
+    SetIntProperty(env, context, result, "mnc", static_cast<int>(cfg.GetMnc()));
 
     return result;
 }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025-2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "resource_manager_napi_value_cache.h"
+
+#include <iterator>
+#include <new>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+thread_local std::unordered_map<napi_env, ResourceManagerNapiValueCache::Cache *>
+    ResourceManagerNapiValueCache::caches_;
+
+bool ResourceManagerNapiValueCache::SetEnabled(napi_env env, bool isEnabled)
+{
+    auto iter = caches_.find(env);
+    if (!isEnabled) {
+        if (iter != caches_.end()) {
+            Cache *cache = iter->second;
+            caches_.erase(iter);
+            napi_remove_env_cleanup_hook(env, OnEnvCleanUp, cache);
+            DestroyCache(cache);
+        }
+        return true;
+    }
+    if (iter != caches_.end()) {
+        return true;
+    }
+    Cache *cache = new (std::nothrow) Cache();
+    if (cache == nullptr) {
+        return false;
+    }
+    cache->env = env;
+    if (napi_add_env_cleanup_hook(env, OnEnvCleanUp, cache) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to add cleanup hook of the value cache");
+        delete cache;
+        return false;
+    }
+    caches_[env] = cache;
+    return true;
+}
+
+napi_value ResourceManagerNapiValueCache::Get(napi_env env, const std::shared_ptr<ResourceManager> &resMgr,
+    uint32_t resId, uint64_t generation)
+{
+    Cache *cache = GetCache(env);
+    if (cache == nullptr) {
+        return nullptr;
+    }
+    auto iter = cache->entries.find({resMgr.get(), resId});
+    if (iter == cache->entries.end()) {
+        return nullptr;
+    }
+    // the address may be reused by another resource manager after the cached one is released
+    if (iter->second->generation != generation || iter->second->resMgr.expired()) {
+        Erase(*cache, iter->second);
+        return nullptr;
+    }
+    napi_value value = nullptr;
+    if (napi_get_reference_value(env, iter->second->ref, &value) != napi_ok || value == nullptr) {
+        Erase(*cache, iter->second);
+        return nullptr;
+    }
+    cache->lruList.splice(cache->lruList.begin(), cache->lruList, iter->second);
+    return value;
+}
+
+void ResourceManagerNapiValueCache::Put(napi_env env, const std::shared_ptr<ResourceManager> &resMgr,
+    uint32_t resId, uint64_t generation, napi_value value)
+{
+    Cache *cache = GetCache(env);
+    if (cache == nullptr) {
+        return;
+    }
+    Key key = {resMgr.get(), resId};
+    auto iter = cache->entries.find(key);
+    if (iter != cache->entries.end()) {
+        Erase(*cache, iter->second);
+    }
+    napi_ref ref = nullptr;
+    if (napi_create_reference(env, value, 1, &ref) != napi_ok) {
+        RESMGR_HILOGE(RESMGR_JS_TAG, "Failed to create reference of the cached value");
+        return;
+    }
+    cache->lruList.push_front({key, resMgr, generation, ref});
+    cache->entries[key] = cache->lruList.begin();
+    while (cache->lruList.size() > MAX_ENTRIES) {
+        Erase(*cache, std::prev(cache->lruList.end()));
+    }
+}
+
+ResourceManagerNapiValueCache::Cache *ResourceManagerNapiValueCache::GetCache(napi_env env)
+{
+    if (caches_.empty()) {
+        return nullptr;
+    }
+    auto iter = caches_.find(env);
+    return iter != caches_.end() ? iter->second : nullptr;
+}
+
+void ResourceManagerNapiValueCache::Erase(Cache &cache, std::list<Entry>::iterator iter)
+{
+    napi_delete_reference(cache.env, iter->ref);
+    cache.entries.erase(iter->key);
+    cache.lruList.erase(iter);
+}
+
+void ResourceManagerNapiValueCache::OnEnvCleanUp(void *data)
+{
+    Cache *cache = static_cast<Cache *>(data);
+    if (cache == nullptr) {
+        return;
+    }
+    caches_.erase(cache->env);
+    DestroyCache(cache);
+}
+
+void ResourceManagerNapiValueCache::DestroyCache(Cache *cache)
+{
+    for (auto &entry : cache->lruList) {
+        napi_delete_reference(cache->env, entry.ref);
+    }
+    delete cache;
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
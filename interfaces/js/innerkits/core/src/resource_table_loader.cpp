@@ -15,6 +15,8 @@
 
 #include "resource_table_loader.h"
 
+#include <atomic>
+#include <mutex>
 #include <unordered_set>
 
 #include "ability_stage_context.h"
@@ -28,8 +30,11 @@ namespace Resource {
 constexpr char BUNDLE_INSTALL_PATH[] = "/data/storage/el1/bundle/";
 constexpr char MERGE_ABC_PATH[] = "/ets/modules.abc";
 
-static std::recursive_mutex mutex_;
-static std::unordered_set<std::string> loadedHaps;
+// the loaded modules are read on every resource manager creation and only written on the first load of a module,
+// so readers load the immutable set atomically and writers swap in a copy
+static std::mutex mutex_;
+static std::shared_ptr<const std::unordered_set<std::string>> loadedHaps =
+    std::make_shared<const std::unordered_set<std::string>>();
 
 void ResourceTableLoader::LoadTable(napi_env env, const std::shared_ptr<ResourceManagerAddon> &addon)
 {
@@ -41,6 +46,9 @@ void ResourceTableLoader::LoadTable(napi_env env, const std::shared_ptr<Resource
         RESMGR_HILOGD(RESMGR_JS_TAG, "HapInfo from context is empty");
         return;
     }
+    if (IsModuleLoaded(moduleName)) {
+        return;
+    }
     Load(env, bundleName, moduleName, loadPath);
 }
 
@@ -63,13 +71,24 @@ void ResourceTableLoader::GetHapInfo(const std::shared_ptr<ResourceManagerAddon>
     loadPath = AbilityBase::ExtractorUtil::GetLoadFilePath(hapModuleInfo->hapPath);
 }
 
+bool ResourceTableLoader::IsModuleLoaded(const std::string &moduleName)
+{
+    return std::atomic_load(&loadedHaps)->count(moduleName) > 0;
+}
+
 bool ResourceTableLoader::CheckModuleLoaded(const std::string &moduleName)
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
-    if (loadedHaps.count(moduleName)) {
+    if (IsModuleLoaded(moduleName)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto modules = std::atomic_load(&loadedHaps);
+    if (modules->count(moduleName)) {
         return true;
     }
-    loadedHaps.insert(moduleName);
+    auto newModules = std::make_shared<std::unordered_set<std::string>>(*modules);
+    newModules->insert(moduleName);
+    std::atomic_store(&loadedHaps, std::shared_ptr<const std::unordered_set<std::string>>(std::move(newModules)));
     return false;
 }
 
@@ -225,6 +225,68 @@ ResourceManager_ErrorCode OH_ResourceManager_GetMediaByName(const NativeResource
 ResourceManager_ErrorCode OH_ResourceManager_GetMediaDataByName(const NativeResourceManager *mgr, const char *resName,
     uint8_t **resultValue, uint64_t *resultLen, uint32_t density);
 
+/**
+ * @brief Callback to release the media data obtained by {@link OH_ResourceManager_GetMediaDataView}.
+ *
+ * @param context the release context returned together with the media data.
+ * @since 20
+ */
+typedef void (*ResourceManager_ReleaseCallback)(void *context);
+
+/**
+ * @brief Obtains the read-only content of the image resource without copying it.
+ *
+ * The media data of uncompressed resources is mapped from the file directly. The data stays valid until
+ * release(releaseContext) is called, the caller must call it exactly once.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ * {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resId Indicates the resource ID.
+ * @param resultValue the read-only media data write to resultValue.
+ * @param resultLen the media length write to resultLen.
+ * @param release the callback to release the media data write to release.
+ * @param releaseContext the context of the release callback write to releaseContext.
+ * @param density The optional parameter ScreenDensity{@link ScreenDensity}, A value of 0 means
+ * to use the density of current system dpi. If this attribute is not required, set this parameter to 0.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid. Possible causes:
+ *         1.Incorrect parameter types; 2.Parameter verification failed.
+           {@link ERROR_CODE_RES_ID_NOT_FOUND} 9001001 - Invalid resource ID.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_ID} 9001002 - No matching resource is found based on the resource ID.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaDataView(const NativeResourceManager *mgr, uint32_t resId,
+    const uint8_t **resultValue, uint64_t *resultLen, ResourceManager_ReleaseCallback *release,
+    void **releaseContext, uint32_t density = 0);
+
+/**
+ * @brief Obtains the read-only content of the image resource without copying it.
+ *
+ * The media data of uncompressed resources is mapped from the file directly. The data stays valid until
+ * release(releaseContext) is called, the caller must call it exactly once.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ * {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resName Indicates the resource name.
+ * @param resultValue the read-only media data write to resultValue.
+ * @param resultLen the media length write to resultLen.
+ * @param release the callback to release the media data write to release.
+ * @param releaseContext the context of the release callback write to releaseContext.
+ * @param density The optional parameter ScreenDensity{@link ScreenDensity}, A value of 0 means
+ * to use the density of current system dpi. If this attribute is not required, set this parameter to 0.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid. Possible causes:
+ *         1.Incorrect parameter types; 2.Parameter verification failed.
+           {@link ERROR_CODE_RES_NAME_NOT_FOUND} 9001003 - Invalid resource name.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_NAME} 9001004 - No matching resource is found based on the resource name.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaDataViewByName(const NativeResourceManager *mgr,
+    const char *resName, const uint8_t **resultValue, uint64_t *resultLen, ResourceManager_ReleaseCallback *release,
+    void **releaseContext, uint32_t density = 0);
+
 /**
  * @brief Obtains the DrawableDescriptor of the media file.
  *
@@ -882,6 +944,226 @@ ResourceManager_ErrorCode OH_ResourceManager_AddResource(const NativeResourceMan
  * @since 12
  */
 ResourceManager_ErrorCode OH_ResourceManager_RemoveResource(const NativeResourceManager *mgr, const char *path);
+
+/**
+ * @brief Obtains a batch of resources by resource ID in one call.
+ *
+ * All the items are resolved under one snapshot of the configuration, the string values are written into
+ * the arena provided by the caller, the value of each string item points into the arena.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param items Indicates the items to obtain, the errorCode and value of each item are written back.
+ * @param count Indicates the count of the items.
+ * @param arena Indicates the buffer the string values are written to, can be null if no string item.
+ * @param arenaSize Indicates the size of the arena.
+ * @param requiredSize the size of the arena required by the string values write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success, the errorCode of each item tells whether the item is found.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - The arena is too small, the string items are not written.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetResourcesByIds(const NativeResourceManager *mgr,
+    ResourceManager_BatchItem *items, uint32_t count, char *arena, uint64_t arenaSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the string resource by resource ID into the buffer provided by the caller.
+ *
+ * No memory is allocated for the result, the string is not formatted.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resId Indicates the resource ID.
+ * @param buffer Indicates the buffer the null-terminated string is written to.
+ * @param bufferSize Indicates the size of the buffer.
+ * @param requiredSize the size of the buffer required by the string including the terminator write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the buffer is null or smaller than requiredSize,
+           then only requiredSize is written.
+           {@link ERROR_CODE_RES_ID_NOT_FOUND} 9001001 - Invalid resource ID.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_ID} 9001002 - No matching resource is found based on the resource ID.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetStringToBuffer(const NativeResourceManager *mgr, uint32_t resId,
+    char *buffer, uint64_t bufferSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the string resource by resource name into the buffer provided by the caller.
+ *
+ * No memory is allocated for the result, the string is not formatted.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resName Indicates the resource name.
+ * @param buffer Indicates the buffer the null-terminated string is written to.
+ * @param bufferSize Indicates the size of the buffer.
+ * @param requiredSize the size of the buffer required by the string including the terminator write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the buffer is null or smaller than requiredSize,
+           then only requiredSize is written.
+           {@link ERROR_CODE_RES_NAME_NOT_FOUND} 9001003 - Invalid resource name.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_NAME} 9001004 - No matching resource is found based on the resource name.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetStringByNameToBuffer(const NativeResourceManager *mgr,
+    const char *resName, char *buffer, uint64_t bufferSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the singular-plural character string represented by the ID string corresponding to
+ * the specified number into the buffer provided by the caller.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resId Indicates the resource ID.
+ * @param num Indicates the number.
+ * @param buffer Indicates the buffer the null-terminated string is written to.
+ * @param bufferSize Indicates the size of the buffer.
+ * @param requiredSize the size of the buffer required by the string including the terminator write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the buffer is null or smaller than requiredSize,
+           then only requiredSize is written.
+           {@link ERROR_CODE_RES_ID_NOT_FOUND} 9001001 - Invalid resource ID.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_ID} 9001002 - No matching resource is found based on the resource ID.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetPluralStringToBuffer(const NativeResourceManager *mgr,
+    uint32_t resId, uint32_t num, char *buffer, uint64_t bufferSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the singular-plural character string represented by the name string corresponding to
+ * the specified number into the buffer provided by the caller.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resName Indicates the resource name.
+ * @param num Indicates the number.
+ * @param buffer Indicates the buffer the null-terminated string is written to.
+ * @param bufferSize Indicates the size of the buffer.
+ * @param requiredSize the size of the buffer required by the string including the terminator write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the buffer is null or smaller than requiredSize,
+           then only requiredSize is written.
+           {@link ERROR_CODE_RES_NAME_NOT_FOUND} 9001003 - Invalid resource name.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_NAME} 9001004 - No matching resource is found based on the resource name.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetPluralStringByNameToBuffer(const NativeResourceManager *mgr,
+    const char *resName, uint32_t num, char *buffer, uint64_t bufferSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the string array resource by resource ID into the arena provided by the caller.
+ *
+ * The strings are written into the arena one after another, each of them null-terminated, and
+ * resultValue[i] points to the i-th string in the arena. No memory is allocated for the result.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resId Indicates the resource ID.
+ * @param resultValue Indicates the array the pointers of the strings are written to.
+ * @param capacity Indicates the count of the elements of resultValue.
+ * @param resultLen the count of the strings write to resultLen.
+ * @param arena Indicates the buffer the strings are written to.
+ * @param arenaSize Indicates the size of the arena.
+ * @param requiredSize the size of the arena required by the strings write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the capacity or the arena is too small,
+           then only resultLen and requiredSize are written.
+           {@link ERROR_CODE_RES_ID_NOT_FOUND} 9001001 - Invalid resource ID.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_ID} 9001002 - No matching resource is found based on the resource ID.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetStringArrayToArena(const NativeResourceManager *mgr,
+    uint32_t resId, const char **resultValue, uint32_t capacity, uint32_t *resultLen, char *arena,
+    uint64_t arenaSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the string array resource by resource name into the arena provided by the caller.
+ *
+ * The strings are written into the arena one after another, each of them null-terminated, and
+ * resultValue[i] points to the i-th string in the arena. No memory is allocated for the result.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resName Indicates the resource name.
+ * @param resultValue Indicates the array the pointers of the strings are written to.
+ * @param capacity Indicates the count of the elements of resultValue.
+ * @param resultLen the count of the strings write to resultLen.
+ * @param arena Indicates the buffer the strings are written to.
+ * @param arenaSize Indicates the size of the arena.
+ * @param requiredSize the size of the arena required by the strings write to requiredSize.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the capacity or the arena is too small,
+           then only resultLen and requiredSize are written.
+           {@link ERROR_CODE_RES_NAME_NOT_FOUND} 9001003 - Invalid resource name.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_NAME} 9001004 - No matching resource is found based on the resource name.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetStringArrayByNameToArena(const NativeResourceManager *mgr,
+    const char *resName, const char **resultValue, uint32_t capacity, uint32_t *resultLen, char *arena,
+    uint64_t arenaSize, uint64_t *requiredSize);
+
+/**
+ * @brief Obtains the content of the media resource by resource ID into the buffer provided by the caller.
+ *
+ * Use {@link OH_ResourceManager_GetMediaDataView} to read the content without copying it.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resId Indicates the resource ID.
+ * @param buffer Indicates the buffer the media data is written to.
+ * @param bufferSize Indicates the size of the buffer.
+ * @param requiredSize the media length write to requiredSize.
+ * @param density The optional parameter ScreenDensity{@link ScreenDensity}, A value of 0 means
+ * to use the density of current system dpi.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the buffer is null or smaller than requiredSize,
+           then only requiredSize is written.
+           {@link ERROR_CODE_RES_ID_NOT_FOUND} 9001001 - Invalid resource ID.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_ID} 9001002 - No matching resource is found based on the resource ID.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaToBuffer(const NativeResourceManager *mgr, uint32_t resId,
+    uint8_t *buffer, uint64_t bufferSize, uint64_t *requiredSize, uint32_t density = 0);
+
+/**
+ * @brief Obtains the content of the media resource by resource name into the buffer provided by the caller.
+ *
+ * Use {@link OH_ResourceManager_GetMediaDataViewByName} to read the content without copying it.
+ *
+ * @param mgr Indicates the pointer to {@link NativeResourceManager}
+ *        {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param resName Indicates the resource name.
+ * @param buffer Indicates the buffer the media data is written to.
+ * @param bufferSize Indicates the size of the buffer.
+ * @param requiredSize the media length write to requiredSize.
+ * @param density The optional parameter ScreenDensity{@link ScreenDensity}, A value of 0 means
+ * to use the density of current system dpi.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_CODE_INVALID_INPUT_PARAMETER} 401 - The input parameter invalid.
+           Possible causes: Incorrect parameter types, or the buffer is null or smaller than requiredSize,
+           then only requiredSize is written.
+           {@link ERROR_CODE_RES_NAME_NOT_FOUND} 9001003 - Invalid resource name.
+           {@link ERROR_CODE_RES_NOT_FOUND_BY_NAME} 9001004 - No matching resource is found based on the resource name.
+           {@link ERROR_CODE_OUT_OF_MEMORY} 9001100 - Out of memory.
+ * @since 20
+ */
+ResourceManager_ErrorCode OH_ResourceManager_GetMediaByNameToBuffer(const NativeResourceManager *mgr,
+    const char *resName, uint8_t *buffer, uint64_t bufferSize, uint64_t *requiredSize, uint32_t density = 0);
 #ifdef __cplusplus
 };
 #endif
@@ -162,6 +162,51 @@ typedef struct ResourceManager_Configuration {
     /** Reserved attributes. */
     uint32_t reserved[20];
 } ResourceManager_Configuration;
+
+/**
+ * @brief Enumerates the resource types supported by the batched lookup.
+ *
+ * @since 20
+ */
+typedef enum ResourceManager_ResourceType {
+    /** Indicates the string resource. */
+    RESOURCE_TYPE_STRING = 0,
+    /** Indicates the color resource. */
+    RESOURCE_TYPE_COLOR = 1,
+    /** Indicates the float resource. */
+    RESOURCE_TYPE_FLOAT = 2,
+    /** Indicates the integer resource. */
+    RESOURCE_TYPE_INT = 3,
+    /** Indicates the boolean resource. */
+    RESOURCE_TYPE_BOOL = 4,
+} ResourceManager_ResourceType;
+
+/**
+ * @brief The item of the batched lookup.
+ *
+ * @since 20
+ */
+typedef struct ResourceManager_BatchItem {
+    /** Indicates the resource ID, set by the caller. */
+    uint32_t resId;
+    /** Indicates the resource type, set by the caller. */
+    ResourceManager_ResourceType type;
+    /** Indicates the result of the lookup of this item. */
+    ResourceManager_ErrorCode errorCode;
+    /** Indicates the value, valid only if errorCode is SUCCESS. */
+    union {
+        /** The string value, points into the arena of the lookup. */
+        const char *stringValue;
+        /** The color value. */
+        uint32_t colorValue;
+        /** The float value. */
+        float floatValue;
+        /** The integer value. */
+        int intValue;
+        /** The boolean value. */
+        bool boolValue;
+    } value;
+} ResourceManager_BatchItem;
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "resourcetablecache_fuzzer.h"
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "resource_table_cache.h"
+
+using namespace std;
+using namespace OHOS::Global::Resource;
+
+namespace OHOS {
+    bool WriteCacheFile(const std::string &path, const uint8_t* data, size_t size)
+    {
+        // the header checksum rejects nearly every input, so it is rewritten to fuzz the checks behind it
+        std::vector<uint8_t> cacheData(data, data + size);
+        ResourceTableCache::UpdateChecksum(cacheData);
+        FILE *fp = fopen(path.c_str(), "wb");
+        if (fp == nullptr) {
+            return false;
+        }
+        bool result = fwrite(cacheData.data(), 1, cacheData.size(), fp) == cacheData.size();
+        fclose(fp);
+        return result;
+    }
+
+    void ResourceTableCacheFuzzTest(const uint8_t* data, size_t size)
+    {
+        std::string path = "/data/local/tmp/resourcetablecache_fuzzer_" + std::to_string(getpid()) + ".table";
+        if (!WriteCacheFile(path, data, size)) {
+            return;
+        }
+        std::shared_ptr<ResourceTableCache> cache = ResourceTableCache::Load(MmapFile::MapReadOnly(path));
+        remove(path.c_str());
+        if (cache == nullptr) {
+            return;
+        }
+        std::vector<ResourceTableCache::Key> keys;
+        cache->GetKeys(keys);
+        ResourceTableCache::Item item;
+        for (uint32_t i = 0; i < cache->GetItemCount(); i++) {
+            if (!cache->GetItem(i, item)) {
+                continue;
+            }
+            cache->FindById(item.id, item);
+            cache->FindByName(item.name, item.type, item);
+        }
+        cache->FindById(size, item);
+        cache->FindByName(std::string(reinterpret_cast<const char *>(data), size), ResType::STRING, item);
+    }
+}
+
+/* Fuzzer entry point */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    /* Run your code on data */
+    if (data == nullptr) {
+        return 0;
+    }
+
+    OHOS::ResourceTableCacheFuzzTest(data, size);
+    return 0;
+}